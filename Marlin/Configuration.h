@@ -1352,6 +1352,11 @@
   #define SEGMENT_LEVELED_MOVES
   #define LEVELED_SEGMENT_LENGTH 5.0 // (mm) Length of all segments (except the last one)
 
+  // For Bilinear, split moves only at mesh cell borders and subdivide within a
+  // cell just enough to keep the leveling error under this value. This produces
+  // far fewer planner blocks than LEVELED_SEGMENT_LENGTH, which is then unused.
+  #define LEVELED_SEGMENT_MAX_ERROR 0.005 // (mm)
+
   /**
    * Enable the G26 Mesh Validation Pattern tool.
    */
@@ -1392,6 +1397,17 @@
       #define BILINEAR_SUBDIVISIONS 3
     #endif
 
+    //
+    // Keep several meshes in SPI Flash, e.g., one per build plate or bed temperature.
+    // Save with 'M420 W<slot>' and load with 'M420 L<slot>'. Requires SPI Flash.
+    //
+    #define BILINEAR_MESH_SLOTS 8
+
+    // Blend the meshes saved at different bed temperatures to suit the
+    // current bed temperature. Enable with 'M420 B1'. Editing a mesh point
+    // stops blending. M500 saves the mesh as it is currently blended.
+    #define BILINEAR_MESH_TEMP_BLEND
+
   #endif
 
 #elif ENABLED(AUTO_BED_LEVELING_UBL)
@@ -1590,6 +1606,15 @@
 //#define EEPROM_BOOT_SILENT    // Keep M503 quiet and only give errors during first load
 #if ENABLED(EEPROM_SETTINGS)
   #define EEPROM_AUTO_INIT  // Init EEPROM automatically on any errors.
+
+  // Keep the settings in SPI Flash instead of the board's EEPROM, as a log of changes
+  // spread over several sectors. M500 only writes what changed. Settings saved in the
+  // old EEPROM aren't carried over, so M500 again after the first boot.
+  //#define SPI_FLASH_EEPROM_EMULATION
+  #if ENABLED(SPI_FLASH_EEPROM_EMULATION)
+    //#define SPI_FLASH_EEPROM_ADDR 0xFE0000  // Default is the 64K below the mesh slots
+    //#define SPI_FLASH_EEPROM_SIZE 0x10000   // Shared by banks of twice MARLIN_EEPROM_SIZE (2K)
+  #endif
 #endif
 
 //
@@ -2420,7 +2445,25 @@
 
 #if ENABLED(TFT_LVGL_UI)
   //#define MKS_WIFI_MODULE  // MKS WiFi module
+  #if ENABLED(MKS_WIFI_MODULE)
+    #define MKS_WIFI_COMPRESSED_UPLOAD // Unpack uploads packed by mks_wifi_pack.py (heatshrink) while writing them to SD
+    #define MKS_WIFI_DMA_RX             // Receive uploads into a DMA ring with idle line detection (STM32F1). M996 reports overruns.
+    #define MKS_WIFI_MEATPACK           // Accept MeatPack-packed G-code over WiFi, once the host turns it on
+  #endif
   #define MIXWARE_MODEL_V     // mixware vertical screen model. KD5.
+  #define LVGL_DMA_FLUSH      // Double-buffered LVGL flush by DMA in the background. SPI TFT on STM32F1 only.
+  #define LVGL_THUMB_CACHE    // Keep decoded G-code thumbnails in SPI Flash, keyed by file name, size and date. The oldest is replaced first.
+  //#define LVGL_HEATSHRINK_ASSETS // Accept icons compressed on the host with heatshrink (-w 8 -l 4), tagged "HS84".
+  #define LVGL_SCREEN_CACHE   // Keep the home, printing, move and extrude screens alive between visits. M996 reports heap use.
+  #define LVGL_GLYPH_CACHE    // Keep the most recently drawn glyphs of the SPI Flash font in RAM. M996 reports hits.
+  #if ENABLED(LVGL_GLYPH_CACHE)
+    #define LVGL_GLYPH_CACHE_SIZE 32 // Glyphs kept, ~72 bytes each
+  #endif
+  #define LVGL_DEFERRED_INIT  // Finish setup() while the boot logo shows, and start WiFi from the main loop.
+#endif
+
+#if ENABLED(TFT_COLOR_UI)
+  #define TFT_DAMAGE_TRACKING // Skip redrawing widgets that haven't changed. M996 reports redraw cost.
 #endif
 
 /**
@@ -1253,6 +1253,18 @@
     // Without a POWER_LOSS_PIN the following option helps reduce wear on the SD card,
     // especially with "vase mode" printing. Set too high and vases cannot be continued.
     #define POWER_LOSS_MIN_Z_CHANGE 0.05 // (mm) Minimum Z change before saving power-loss data
+
+    // Keep the power-loss data as a journal of changes in a preallocated, contiguous
+    // /PLR written as raw SD blocks. Much cheaper to save than rewriting the file.
+    #define POWER_LOSS_JOURNAL
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      #define POWER_LOSS_JOURNAL_BLOCKS 64  // (512-byte blocks) Size of /PLR. Starts over with a full record when used up.
+    #endif
+
+    // With a POWER_LOSS_PIN, stop the steppers before the outage save so it holds the true
+    // position and the command being run, not the end of the planned moves. Resumes within
+    // a few commands of the outage rather than at the last layer.
+    //#define POWER_LOSS_RESUME_AT_COMMAND
   #endif
 
   /**
@@ -1383,6 +1395,16 @@
 
   // Add an optimized binary file transfer mode, initiated with 'M28 B1'
   //#define BINARY_FILE_TRANSFER
+  #if ENABLED(BINARY_FILE_TRANSFER)
+    /**
+     * Let the host send up to this many packets ahead of the oldest unacknowledged one.
+     * Packets are acknowledged as they arrive, damaged ones are asked for again by number,
+     * and file data is written to SD in whole sectors while the stream is quiet.
+     * Comment out for the original one-packet-at-a-time transfer.
+     */
+    #define BINARY_STREAM_WINDOW       4    // Packets (2, 4, 8, ...)
+    #define BINARY_STREAM_PACKET_SIZE  512  // Largest packet payload, in bytes
+  #endif
 
   /**
    * Set this option to one of the following (or the board's defaults apply):
@@ -1792,6 +1814,18 @@
 
 #endif
 
+/**
+ * G29 Fast Approach
+ * Predict the height of each grid point from the points already probed
+ * and approach it at Z_PROBE_SPEED_FAST, probing only the last few mm at
+ * Z_PROBE_SPEED_SLOW. Makes denser grids practical with single probing.
+ * Not for MULTIPLE_PROBING 2 without EXTRA_PROBING, which already probes fast first.
+ */
+#define G29_FAST_APPROACH
+#if ENABLED(G29_FAST_APPROACH)
+  #define G29_FAST_APPROACH_MARGIN 1.0  // (mm) Height above the predicted bed to start slow probing
+#endif
+
 /**
  * Thermal Probe Compensation
  * Probe measurements are adjusted to compensate for temperature distortion.
@@ -1882,6 +1916,14 @@
  * Preparing your G-code: https://github.com/colinrgodsey/step-daemon
  */
 //#define DIRECT_STEPPING
+#if ENABLED(DIRECT_STEPPING)
+  /**
+   * Play pages prepared in advance from a file on the SD card with 'G6 !file'.
+   * Pages are read ahead into the free page buffers while the steppers run,
+   * so no host is needed. Make the file with buildroot/share/scripts/g6_pages.py.
+   */
+  #define DIRECT_STEPPING_SD
+#endif
 
 /**
  * G38 Probe Target
@@ -3221,6 +3263,17 @@
  */
 #define AUTO_REPORT_TEMPERATURES
 
+/**
+ * Status Snapshot
+ * Read and format the temperatures, position, progress, fan and flow at most
+ * once per interval and send the cached text to every host that polls M105,
+ * M155 or the WiFi module. Adds M408 to report all of it in one JSON line.
+ */
+#define STATUS_SNAPSHOT
+#if ENABLED(STATUS_SNAPSHOT)
+  #define STATUS_SNAPSHOT_MS 250  // (ms) Longest age of the reported values
+#endif
+
 /**
  * Include capabilities in M115 output
  */
@@ -3720,5 +3773,10 @@
 //
 //#define PINS_DEBUGGING
 
+//
+// M990 - Report how long each stage of startup took, including those deferred until after setup()
+//
+//#define BOOT_STAGE_TIMING
+
 // Enable Marlin dev mode which adds some special commands
 //#define MARLIN_DEV_MODE
@@ -393,6 +393,9 @@ uint8_t SPIClass::dmaTransferRepeat(uint16_t length) {
   _currentSetting->state = SPI_STATE_TRANSFER;
   dma_set_num_transfers(_currentSetting->spiDmaDev, _currentSetting->spiRxDmaChannel, length);
   dma_set_num_transfers(_currentSetting->spiDmaDev, _currentSetting->spiTxDmaChannel, length);
+  // A transfer finished by the receive callback leaves its flags set
+  dma_clear_isr_bits(_currentSetting->spiDmaDev, _currentSetting->spiRxDmaChannel);
+  dma_clear_isr_bits(_currentSetting->spiDmaDev, _currentSetting->spiTxDmaChannel);
   dma_enable(_currentSetting->spiDmaDev, _currentSetting->spiRxDmaChannel);// enable receive
   dma_enable(_currentSetting->spiDmaDev, _currentSetting->spiTxDmaChannel);// enable transmit
   spi_rx_dma_enable(_currentSetting->spi_d);
@@ -502,10 +505,10 @@ uint8_t SPIClass::dmaSendAsync(const void * transmitBuf, uint16_t length, bool m
       dma_bit_size, (volatile void*)transmitBuf, dma_bit_size, flags);// Transmit buffer DMA
   dma_set_num_transfers(_currentSetting->spiDmaDev, _currentSetting->spiTxDmaChannel, length);
   dma_clear_isr_bits(_currentSetting->spiDmaDev, _currentSetting->spiTxDmaChannel);
+  _currentSetting->state = SPI_STATE_TRANSMIT; // Before enabling, a short transfer may complete at once
   dma_enable(_currentSetting->spiDmaDev, _currentSetting->spiTxDmaChannel);// enable transmit
   spi_tx_dma_enable(_currentSetting->spi_d);
 
-  _currentSetting->state = SPI_STATE_TRANSMIT;
   return b;
 }
 
@@ -517,19 +520,23 @@ uint8_t SPIClass::dmaSendAsync(const void * transmitBuf, uint16_t length, bool m
 void SPIClass::onReceive(void(*callback)()) {
   _currentSetting->receiveCallback = callback;
   if (callback) {
+    // Several instances may share a port, so route its DMA IRQ to this one
     switch (_currentSetting->spi_d->clk_id) {
     #if BOARD_NR_SPI >= 1
     case RCC_SPI1:
+      _spi1_this = (void*)this;
       dma_attach_interrupt(_currentSetting->spiDmaDev, _currentSetting->spiRxDmaChannel, &SPIClass::_spi1EventCallback);
       break;
     #endif
     #if BOARD_NR_SPI >= 2
     case RCC_SPI2:
+      _spi2_this = (void*)this;
       dma_attach_interrupt(_currentSetting->spiDmaDev, _currentSetting->spiRxDmaChannel, &SPIClass::_spi2EventCallback);
       break;
     #endif
     #if BOARD_NR_SPI >= 3
     case RCC_SPI3:
+      _spi3_this = (void*)this;
       dma_attach_interrupt(_currentSetting->spiDmaDev, _currentSetting->spiRxDmaChannel, &SPIClass::_spi3EventCallback);
       break;
     #endif
@@ -545,19 +552,23 @@ void SPIClass::onReceive(void(*callback)()) {
 void SPIClass::onTransmit(void(*callback)()) {
   _currentSetting->transmitCallback = callback;
   if (callback) {
+    // Several instances may share a port, so route its DMA IRQ to this one
     switch (_currentSetting->spi_d->clk_id) {
     #if BOARD_NR_SPI >= 1
     case RCC_SPI1:
+      _spi1_this = (void*)this;
       dma_attach_interrupt(_currentSetting->spiDmaDev, _currentSetting->spiTxDmaChannel, &SPIClass::_spi1EventCallback);
       break;
     #endif
     #if BOARD_NR_SPI >= 2
      case RCC_SPI2:
+      _spi2_this = (void*)this;
       dma_attach_interrupt(_currentSetting->spiDmaDev, _currentSetting->spiTxDmaChannel, &SPIClass::_spi2EventCallback);
       break;
     #endif
     #if BOARD_NR_SPI >= 3
     case RCC_SPI3:
+      _spi3_this = (void*)this;
       dma_attach_interrupt(_currentSetting->spiDmaDev, _currentSetting->spiTxDmaChannel, &SPIClass::_spi3EventCallback);
       break;
     #endif
@@ -0,0 +1,236 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * HAL PersistentStore for STM32F1
+ * Implementation of EEPROM settings in SPI Flash (W25Qxx)
+ *
+ * The settings are kept in RAM and the flash holds a log of changes. The log
+ * area is split into banks of whole sectors. A bank starts with a record of
+ * the full image, followed by a record for each run of bytes changed by a
+ * save, so M500 after changing one value writes a few bytes and no erase.
+ *
+ * When a bank is full the next one is erased and started with the full
+ * image, so the banks are worn in turn. Its header is written last, so the
+ * newest bank with a header always has a complete image. On boot the image
+ * is rebuilt from the newest bank and its records, up to the first empty
+ * or bad one. A save torn by a reset leaves the records before it, and the
+ * next save moves on to a new bank.
+ */
+
+#ifdef __STM32F1__
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(SPI_FLASH_EEPROM_EMULATION)
+
+#include "../shared/eeprom_api.h"
+#include "../../libs/W25Qxx.h"
+
+#ifndef MARLIN_EEPROM_SIZE
+  #define MARLIN_EEPROM_SIZE 0x800  // 2KB
+#endif
+size_t PersistentStore::capacity() { return MARLIN_EEPROM_SIZE; }
+
+#define EEPROM_BANK_MARKER  0x4B4E4245  // "EBNK"
+#define EEPROM_CHUNK        16          // Bytes per dirty flag
+#define EEPROM_RECORD_MAX   64          // Largest change record
+
+// Room in each bank for the full image and as much again in changes
+#define BANK_SIZE (((2 * (MARLIN_EEPROM_SIZE) + (SPI_FLASH_SectorSize) - 1) / (SPI_FLASH_SectorSize)) * (SPI_FLASH_SectorSize))
+#define BANK_COUNT ((SPI_FLASH_EEPROM_SIZE) / (BANK_SIZE))
+#define BANK_ADDR(B) (uint32_t(SPI_FLASH_EEPROM_ADDR) + uint32_t(B) * (BANK_SIZE))
+
+static_assert(BANK_COUNT >= 2, "SPI_FLASH_EEPROM_SIZE must hold at least two banks of twice MARLIN_EEPROM_SIZE.");
+static_assert((MARLIN_EEPROM_SIZE) % (EEPROM_CHUNK) == 0, "MARLIN_EEPROM_SIZE must be a multiple of 16.");
+
+typedef struct {
+  uint32_t marker,
+           seq;         // Higher is newer
+} bank_header_t;
+
+typedef struct {
+  uint16_t pos, size,   // Span of the image. The first record of a bank has all of it.
+           crc;         // CRC16 of pos, size and the data
+} record_header_t;
+
+static uint8_t ram_eeprom[MARLIN_EEPROM_SIZE] __attribute__((aligned(4)));
+static uint8_t dirty[(MARLIN_EEPROM_SIZE) / (EEPROM_CHUNK) / 8 + 1];
+static bool loaded; // = false
+
+static uint8_t bank;
+static uint32_t bank_seq,   // Highest sequence seen
+                next_addr;  // Where the next record goes, or 0 to start a new bank
+
+#define IS_DIRTY(C) TEST(dirty[(C) >> 3], (C) & 7)
+
+static uint16_t record_crc(const record_header_t &rec, const uint8_t *data) {
+  uint16_t crc = 0;
+  crc16(&crc, &rec, offsetof(record_header_t, crc));
+  crc16(&crc, data, rec.size);
+  return crc;
+}
+
+// Load the full image of a bank into RAM. Return the address after it, or 0 if it's bad.
+static uint32_t load_base(const uint8_t b) {
+  record_header_t rec;
+  const uint32_t addr = BANK_ADDR(b) + sizeof(bank_header_t);
+  W25QXX.SPI_FLASH_BufferRead((uint8_t*)&rec, addr, sizeof(rec));
+  if (rec.pos != 0 || rec.size != MARLIN_EEPROM_SIZE) return 0;
+  W25QXX.SPI_FLASH_BufferRead(ram_eeprom, addr + sizeof(rec), rec.size);
+  return rec.crc == record_crc(rec, ram_eeprom) ? addr + sizeof(rec) + rec.size : 0;
+}
+
+// Apply the change records that follow the full image
+static void replay(uint32_t addr) {
+  const uint32_t end = BANK_ADDR(bank) + (BANK_SIZE);
+  uint8_t data[EEPROM_RECORD_MAX];
+  next_addr = 0;
+  while (addr + sizeof(record_header_t) <= end) {
+    record_header_t rec;
+    W25QXX.SPI_FLASH_BufferRead((uint8_t*)&rec, addr, sizeof(rec));
+    if (rec.pos == 0xFFFF) { next_addr = addr; break; }             // Erased, end of the log
+    if (!WITHIN(rec.size, 1, EEPROM_RECORD_MAX) || rec.pos + rec.size > MARLIN_EEPROM_SIZE) break;
+    W25QXX.SPI_FLASH_BufferRead(data, addr + sizeof(rec), rec.size);
+    if (rec.crc != record_crc(rec, data)) break;                    // Torn by a reset
+    memcpy(&ram_eeprom[rec.pos], data, rec.size);
+    addr += sizeof(rec) + rec.size;
+  }
+}
+
+// Rebuild the image from the newest bank with a good full image
+static void load() {
+  bank_header_t hdr[BANK_COUNT];
+  bank_seq = 0;
+  LOOP_L_N(b, BANK_COUNT) {
+    W25QXX.SPI_FLASH_BufferRead((uint8_t*)&hdr[b], BANK_ADDR(b), sizeof(bank_header_t));
+    if (hdr[b].marker == EEPROM_BANK_MARKER) NOLESS(bank_seq, hdr[b].seq);
+    else hdr[b].seq = 0;
+  }
+
+  for (;;) {
+    int8_t newest = -1;
+    LOOP_L_N(b, BANK_COUNT)
+      if (hdr[b].seq && (newest < 0 || hdr[b].seq > hdr[newest].seq)) newest = b;
+
+    if (newest < 0) {                       // Nothing saved yet
+      memset(ram_eeprom, 0xFF, sizeof(ram_eeprom));
+      bank = BANK_COUNT - 1;
+      next_addr = 0;
+      return;
+    }
+
+    bank = newest;
+    const uint32_t addr = load_base(bank);
+    if (addr) return replay(addr);
+    hdr[bank].seq = 0;                      // Try the one before
+  }
+}
+
+// Erase the next bank and start it with the full image
+static bool new_bank() {
+  if (++bank >= BANK_COUNT) bank = 0;
+  const uint32_t addr = BANK_ADDR(bank);
+  for (uint32_t s = 0; s < (BANK_SIZE); s += SPI_FLASH_SectorSize)
+    W25QXX.SPI_FLASH_SectorErase(addr + s);
+
+  record_header_t rec = { 0, MARLIN_EEPROM_SIZE, 0 };
+  rec.crc = record_crc(rec, ram_eeprom);
+  W25QXX.SPI_FLASH_BufferWrite((uint8_t*)&rec, addr + sizeof(bank_header_t), sizeof(rec));
+  W25QXX.SPI_FLASH_BufferWrite(ram_eeprom, addr + sizeof(bank_header_t) + sizeof(rec), MARLIN_EEPROM_SIZE);
+
+  bank_header_t hdr = { EEPROM_BANK_MARKER, ++bank_seq };
+  W25QXX.SPI_FLASH_BufferWrite((uint8_t*)&hdr, addr, sizeof(hdr));
+
+  next_addr = load_base(bank);            // Read it back
+  return next_addr != 0;
+}
+
+// Call fn(pos, size) for each run of dirty chunks, split to fit in a record
+template<typename F>
+static void dirty_runs(F fn) {
+  for (uint16_t c = 0; c < (MARLIN_EEPROM_SIZE) / (EEPROM_CHUNK);) {
+    if (!IS_DIRTY(c)) { c++; continue; }
+    const uint16_t first = c;
+    while (c < (MARLIN_EEPROM_SIZE) / (EEPROM_CHUNK) && IS_DIRTY(c) && (c - first + 1) * (EEPROM_CHUNK) <= EEPROM_RECORD_MAX) c++;
+    fn(first * (EEPROM_CHUNK), (c - first) * (EEPROM_CHUNK));
+  }
+}
+
+bool PersistentStore::access_start() {
+  W25QXX.init(SPI_QUARTER_SPEED);
+  if (!loaded) { load(); loaded = true; }
+  return true;
+}
+
+bool PersistentStore::access_finish() {
+  bool changed = false;
+  LOOP_L_N(i, sizeof(dirty)) if (dirty[i]) { changed = true; break; }
+  if (!changed) return true;
+
+  W25QXX.init(SPI_QUARTER_SPEED);
+
+  // Append the changes if they fit in the bank, else start the next bank
+  uint32_t needed = 0;
+  dirty_runs([&](const uint16_t, const uint16_t size) { needed += sizeof(record_header_t) + size; });
+
+  bool ok;
+  if (next_addr && next_addr + needed <= BANK_ADDR(bank) + (BANK_SIZE)) {
+    dirty_runs([](const uint16_t pos, const uint16_t size) {
+      record_header_t rec = { pos, size, 0 };
+      rec.crc = record_crc(rec, &ram_eeprom[pos]);
+      W25QXX.SPI_FLASH_BufferWrite((uint8_t*)&rec, next_addr, sizeof(rec));
+      W25QXX.SPI_FLASH_BufferWrite(&ram_eeprom[pos], next_addr + sizeof(rec), size);
+      next_addr += sizeof(rec) + size;
+    });
+    ok = true;
+  }
+  else
+    ok = new_bank();
+
+  ZERO(dirty);
+  return ok;
+}
+
+bool PersistentStore::write_data(int &pos, const uint8_t *value, size_t size, uint16_t *crc) {
+  if (pos < 0 || pos + size > MARLIN_EEPROM_SIZE) return true;
+  crc16(crc, value, size);
+  while (size--) {
+    // Only the chunks that changed get written
+    if (ram_eeprom[pos] != *value) {
+      ram_eeprom[pos] = *value;
+      SBI(dirty[pos / (EEPROM_CHUNK) / 8], (pos / (EEPROM_CHUNK)) & 7);
+    }
+    pos++;
+    value++;
+  }
+  return false;
+}
+
+bool PersistentStore::read_data(int &pos, uint8_t *value, const size_t size, uint16_t *crc, const bool writing/*=true*/) {
+  if (pos < 0 || pos + size > MARLIN_EEPROM_SIZE) return true;
+  const uint8_t * const buff = writing ? &value[0] : &ram_eeprom[pos];
+  if (writing) for (size_t i = 0; i < size; i++) value[i] = ram_eeprom[pos + i];
+  crc16(crc, buff, size);
+  pos += size;
+  return false;
+}
+
+#endif // SPI_FLASH_EEPROM_EMULATION
+#endif // __STM32F1__
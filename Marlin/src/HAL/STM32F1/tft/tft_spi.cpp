@@ -29,6 +29,8 @@
 // TFT_SPI tft;
 
 SPIClass TFT_SPI::SPIx(1);
+volatile bool TFT_SPI::transferActive = false;
+void (*TFT_SPI::transferCallback)() = nullptr;
 
 #define TFT_CS_H  OUT_WRITE(TFT_CS_PIN, HIGH)
 #define TFT_CS_L  OUT_WRITE(TFT_CS_PIN, LOW)
@@ -85,6 +87,7 @@ void TFT_SPI::Init() {
 }
 
 void TFT_SPI::DataTransferBegin(uint16_t DataSize) {
+  while (transferActive) { /* wait for the background transfer to release the bus */ }
   SPIx.setDataSize(DataSize);
   SPIx.begin();
   TFT_CS_L;
@@ -122,10 +125,19 @@ uint32_t TFT_SPI::ReadID(uint16_t Reg) {
 }
 
 bool TFT_SPI::isBusy() {
-  return false;
+  return transferActive;
 }
 
 void TFT_SPI::Abort() {
+  if (transferActive) {
+    SPIx.onTransmit(nullptr);
+    SPIx.dmaSendAsync(nullptr, 0); // Let the running transfer drain
+    // Unless it completed first, call back as TransferComplete would. LVGL waits for its buffer.
+    if (transferActive) {
+      transferActive = false;
+      if (transferCallback) transferCallback();
+    }
+  }
   DataTransferEnd();
 }
 
@@ -146,4 +158,21 @@ void TFT_SPI::TransmitDMA(uint32_t MemoryIncrease, uint16_t *Data, uint16_t Coun
   DataTransferEnd();
 }
 
+void TFT_SPI::TransmitDMA_IT(uint32_t MemoryIncrease, uint16_t *Data, uint16_t Count, void (*callback)()) {
+  DataTransferBegin();
+  TFT_DC_H;
+  transferCallback = callback;
+  transferActive = true;
+  SPIx.onTransmit(TransferComplete);
+  SPIx.dmaSendAsync(Data, Count, MemoryIncrease == DMA_MINC_ENABLE);
+}
+
+// Called from the SPI TX DMA interrupt once the last word has left the shifter
+void TFT_SPI::TransferComplete() {
+  SPIx.onTransmit(nullptr); // Blocking dmaSend() only waits when no callback is set
+  DataTransferEnd();
+  transferActive = false;
+  if (transferCallback) transferCallback();
+}
+
 #endif // HAS_SPI_TFT
@@ -44,6 +44,11 @@ private:
   static uint32_t ReadID(uint16_t Reg);
   static void Transmit(uint16_t Data);
   static void TransmitDMA(uint32_t MemoryIncrease, uint16_t *Data, uint16_t Count);
+  static void TransmitDMA_IT(uint32_t MemoryIncrease, uint16_t *Data, uint16_t Count, void (*callback)());
+  static void TransferComplete();
+
+  static volatile bool transferActive;
+  static void (*transferCallback)();
 
 public:
   static SPIClass SPIx;
@@ -61,6 +66,8 @@ public:
   static void WriteReg(uint16_t Reg) { WRITE(TFT_A0_PIN, LOW); Transmit(Reg); WRITE(TFT_A0_PIN, HIGH); }
 
   static void WriteSequence(uint16_t *Data, uint16_t Count) { TransmitDMA(DMA_MINC_ENABLE, Data, Count); }
+  // Start a background transfer; the callback runs from the DMA complete interrupt
+  static void WriteSequenceIT(uint16_t *Data, uint16_t Count, void (*callback)() = nullptr) { TransmitDMA_IT(DMA_MINC_ENABLE, Data, Count, callback); }
   static void WriteMultiple(uint16_t Color, uint16_t Count) { static uint16_t Data; Data = Color; TransmitDMA(DMA_MINC_DISABLE, &Data, Count); }
   static void WriteMultiple(uint16_t Color, uint32_t Count) {
     static uint16_t Data; Data = Color;
@@ -174,6 +174,10 @@
   #include "feature/bedlevel/bedlevel.h"
 #endif
 
+#if ENABLED(BILINEAR_MESH_TEMP_BLEND)
+  #include "feature/bedlevel/abl/mesh_store.h"
+#endif
+
 #if ENABLED(GCODE_REPEAT_MARKERS)
   #include "feature/repeat.h"
 #endif
@@ -700,6 +704,10 @@ void idle(TERN_(ADVANCED_PAUSE_FEATURE, bool no_stepper_sleep/*=false*/)) {
 
   // Direct Stepping
   TERN_(DIRECT_STEPPING, page_manager.write_responses());
+  TERN_(DIRECT_STEPPING_SD, page_manager.idle());
+
+  // Blend saved bed meshes for the bed temperature
+  TERN_(BILINEAR_MESH_TEMP_BLEND, mesh_store.blend_task());
 
   // Update the LVGL interface
   TERN_(HAS_TFT_LVGL_UI, LV_TASK_HANDLER());
@@ -851,6 +859,40 @@ inline void tmc_standby_setup() {
   #endif
 }
 
+#if ENABLED(BOOT_STAGE_TIMING)
+
+  #define BOOT_STAGES_MAX 24
+
+  typedef struct {
+    PGM_P name;
+    uint16_t ms;
+    bool deferred;  // Run from idle() after setup()
+  } boot_stage_t;
+
+  static boot_stage_t boot_stages[BOOT_STAGES_MAX];
+  static uint8_t boot_stage_count; // = 0
+
+  // Keep the stages that took any time at all, in the order they finished
+  void boot_stage_done(PGM_P const name, const millis_t start_ms, const bool deferred/*=false*/) {
+    const millis_t ms = millis() - start_ms;
+    if (ms && boot_stage_count < BOOT_STAGES_MAX)
+      boot_stages[boot_stage_count++] = { name, uint16_t(_MIN(ms, 0xFFFFUL)), deferred };
+  }
+
+  void report_boot_stages() {
+    SERIAL_ECHOLNPGM("Boot stages (ms):");
+    LOOP_L_N(i, boot_stage_count) {
+      const boot_stage_t &s = boot_stages[i];
+      SERIAL_ECHOPGM("  ");
+      serialprintPGM(s.name);
+      SERIAL_ECHOPAIR(" ", s.ms);
+      if (s.deferred) SERIAL_ECHOPGM(" (deferred)");
+      SERIAL_EOL();
+    }
+  }
+
+#endif
+
 /**
  * Marlin entry-point: Set up before the program loop
  *  - Set up the kill pin, filament runout, power hold
@@ -885,7 +927,7 @@ void setup() {
   #else
     #define SETUP_LOG(...) NOOP
   #endif
-  #define SETUP_RUN(C) do{ SETUP_LOG(STRINGIFY(C)); C; }while(0)
+  #define SETUP_RUN(C) do{ SETUP_LOG(STRINGIFY(C)); BOOT_STAGE(C); }while(0)
 
   MYSERIAL0.begin(BAUDRATE);
   millis_t serial_connect_timeout = millis() + 1000UL;
@@ -1260,6 +1302,7 @@ void setup() {
   marlin_state = MF_RUNNING;
 
   SETUP_LOG("setup() completed.");
+  TERN_(BOOT_STAGE_TIMING, boot_stage_done(PSTR("setup()"), 0));
 }
 
 /**
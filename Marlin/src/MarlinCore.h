@@ -52,6 +52,18 @@ void disable_e_steppers();
 void disable_all_steppers();
 
 void kill(PGM_P const lcd_error=nullptr, PGM_P const lcd_component=nullptr, const bool steppers_off=false);
+
+#if ENABLED(BOOT_STAGE_TIMING)
+  void boot_stage_done(PGM_P const name, const millis_t start_ms, const bool deferred=false);
+  void report_boot_stages();
+  // Run a stage of setup() and keep how long it took for M990
+  #define BOOT_STAGE(C) do{ const millis_t stage_ms = millis(); C; boot_stage_done(PSTR(STRINGIFY(C)), stage_ms); }while(0)
+  // The same for a stage put off until idle()
+  #define BOOT_STAGE_DEFERRED(C) do{ const millis_t stage_ms = millis(); C; boot_stage_done(PSTR(STRINGIFY(C)), stage_ms, true); }while(0)
+#else
+  #define BOOT_STAGE(C) C
+  #define BOOT_STAGE_DEFERRED(C) C
+#endif
 void minkill(const bool steppers_off=false);
 
 // Global State of the firmware
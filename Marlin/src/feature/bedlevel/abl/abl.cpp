@@ -27,6 +27,7 @@
 #include "../bedlevel.h"
 
 #include "../../../module/motion.h"
+#include "../../../module/planner.h"
 
 #define DEBUG_OUT ENABLED(DEBUG_LEVELING_FEATURE)
 #include "../../../core/debug_out.h"
@@ -244,12 +245,6 @@ void print_bilinear_leveling_grid() {
   }
 #endif // ABL_BILINEAR_SUBDIVISION
 
-// Refresh after other values have been updated
-void refresh_bed_level() {
-  bilinear_grid_factor = bilinear_grid_spacing.reciprocal();
-  TERN_(ABL_BILINEAR_SUBDIVISION, bed_level_virt_interpolate());
-}
-
 #if ENABLED(ABL_BILINEAR_SUBDIVISION)
   #define ABL_BG_SPACING(A) bilinear_grid_spacing_virt.A
   #define ABL_BG_FACTOR(A)  bilinear_grid_factor_virt.A
@@ -264,94 +259,183 @@ void refresh_bed_level() {
   #define ABL_BG_GRID(X,Y)  z_values[X][Y]
 #endif
 
-// Get the Z adjustment for non-linear bed leveling
-float bilinear_z_offset(const xy_pos_t &raw) {
+/**
+ * Bilinear coefficients for each grid cell, so that within a cell
+ *   Z = a + b * tx + c * ty + d * tx * ty
+ * where tx and ty are the position ratios (0..1) inside the cell.
+ */
+typedef struct { float a, b, c, d; } bilinear_cell_t;
+static bilinear_cell_t bilinear_cells[(ABL_BG_POINTS_X) - 1][(ABL_BG_POINTS_Y) - 1];
+
+static void bilinear_cells_refresh() {
+  LOOP_L_N(x, (ABL_BG_POINTS_X) - 1)
+    LOOP_L_N(y, (ABL_BG_POINTS_Y) - 1) {
+      const float z1 = ABL_BG_GRID(x,     y    ),  // left-front
+                  z2 = ABL_BG_GRID(x,     y + 1),  // left-back
+                  z3 = ABL_BG_GRID(x + 1, y    ),  // right-front
+                  z4 = ABL_BG_GRID(x + 1, y + 1);  // right-back
+      bilinear_cell_t &cell = bilinear_cells[x][y];
+      cell.a = z1;
+      cell.b = z3 - z1;
+      cell.c = z2 - z1;
+      cell.d = z4 - z3 - z2 + z1;
+    }
+}
 
-  static float z1, d2, z3, d4, L, D;
+// Refresh after other values have been updated
+void refresh_bed_level() {
+  bilinear_grid_factor = bilinear_grid_spacing.reciprocal();
+  TERN_(ABL_BILINEAR_SUBDIVISION, bed_level_virt_interpolate());
+  bilinear_cells_refresh();
+}
 
-  static xy_pos_t prev { -999.999, -999.999 }, ratio;
+// Get the Z adjustment for non-linear bed leveling
+float bilinear_z_offset(const xy_pos_t &raw) {
 
-  // Whole units for the grid line indices. Constrained within bounds.
-  static xy_int8_t thisg, nextg, lastg { -99, -99 };
+  // Cell of the last lookup. Consecutive segments almost always stay in it.
+  static xy_int8_t thisg { -99, -99 };
+  static const bilinear_cell_t *cell = &bilinear_cells[0][0];
 
-  // XY relative to the probed area
-  xy_pos_t rel = raw - bilinear_start.asFloat();
+  // Position in grid units, relative to the probed area
+  const xy_pos_t ratio = {
+    (raw.x - bilinear_start.x) * ABL_BG_FACTOR(x),
+    (raw.y - bilinear_start.y) * ABL_BG_FACTOR(y)
+  };
 
-  #if ENABLED(EXTRAPOLATE_BEYOND_GRID)
-    #define FAR_EDGE_OR_BOX 2   // Keep using the last grid box
-  #else
-    #define FAR_EDGE_OR_BOX 1   // Just use the grid far edge
-  #endif
+  // Ratio within the cached cell
+  xy_pos_t t = { ratio.x - thisg.x, ratio.y - thisg.y };
 
-  if (prev.x != rel.x) {
-    prev.x = rel.x;
-    ratio.x = rel.x * ABL_BG_FACTOR(x);
-    const float gx = constrain(FLOOR(ratio.x), 0, ABL_BG_POINTS_X - (FAR_EDGE_OR_BOX));
-    ratio.x -= gx;      // Subtract whole to get the ratio within the grid box
+  if (!WITHIN(t.x, 0, 1) || !WITHIN(t.y, 0, 1)) {
+    // Crossed into another cell. Constrain to the grid, using the outer cells beyond the edges.
+    thisg.x = constrain(FLOOR(ratio.x), 0, (ABL_BG_POINTS_X) - 2);
+    thisg.y = constrain(FLOOR(ratio.y), 0, (ABL_BG_POINTS_Y) - 2);
+    t.set(ratio.x - thisg.x, ratio.y - thisg.y);
 
     #if DISABLED(EXTRAPOLATE_BEYOND_GRID)
       // Beyond the grid maintain height at grid edges
-      NOLESS(ratio.x, 0); // Never <0 (>1 is ok when nextg.x==thisg.x)
+      LIMIT(t.x, 0, 1);
+      LIMIT(t.y, 0, 1);
     #endif
 
-    thisg.x = gx;
-    nextg.x = _MIN(thisg.x + 1, ABL_BG_POINTS_X - 1);
+    cell = &bilinear_cells[thisg.x][thisg.y];
   }
 
-  if (prev.y != rel.y || lastg.x != thisg.x) {
+  return cell->a + t.x * (cell->b + t.y * cell->d) + t.y * cell->c;
+}
+
+#if ENABLED(MARLIN_DEV_MODE)
+
+  // The row interpolation that bilinear_z_offset() replaced, for M420 S3 to compare against
+  float bilinear_z_offset_rows(const xy_pos_t &raw) {
+
+    static float z1, d2, z3, d4, L, D;
+
+    static xy_pos_t prev { -999.999, -999.999 }, ratio;
 
-    if (prev.y != rel.y) {
-      prev.y = rel.y;
-      ratio.y = rel.y * ABL_BG_FACTOR(y);
-      const float gy = constrain(FLOOR(ratio.y), 0, ABL_BG_POINTS_Y - (FAR_EDGE_OR_BOX));
-      ratio.y -= gy;
+    // Whole units for the grid line indices. Constrained within bounds.
+    static xy_int8_t thisg, nextg, lastg { -99, -99 };
+
+    // XY relative to the probed area
+    xy_pos_t rel = raw - bilinear_start.asFloat();
+
+    #if ENABLED(EXTRAPOLATE_BEYOND_GRID)
+      #define FAR_EDGE_OR_BOX 2   // Keep using the last grid box
+    #else
+      #define FAR_EDGE_OR_BOX 1   // Just use the grid far edge
+    #endif
+
+    if (prev.x != rel.x) {
+      prev.x = rel.x;
+      ratio.x = rel.x * ABL_BG_FACTOR(x);
+      const float gx = constrain(FLOOR(ratio.x), 0, ABL_BG_POINTS_X - (FAR_EDGE_OR_BOX));
+      ratio.x -= gx;      // Subtract whole to get the ratio within the grid box
 
       #if DISABLED(EXTRAPOLATE_BEYOND_GRID)
         // Beyond the grid maintain height at grid edges
-        NOLESS(ratio.y, 0); // Never < 0.0. (> 1.0 is ok when nextg.y==thisg.y.)
+        NOLESS(ratio.x, 0); // Never <0 (>1 is ok when nextg.x==thisg.x)
       #endif
 
-      thisg.y = gy;
-      nextg.y = _MIN(thisg.y + 1, ABL_BG_POINTS_Y - 1);
+      thisg.x = gx;
+      nextg.x = _MIN(thisg.x + 1, ABL_BG_POINTS_X - 1);
     }
 
-    if (lastg != thisg) {
-      lastg = thisg;
-      // Z at the box corners
-      z1 = ABL_BG_GRID(thisg.x, thisg.y);       // left-front
-      d2 = ABL_BG_GRID(thisg.x, nextg.y) - z1;  // left-back (delta)
-      z3 = ABL_BG_GRID(nextg.x, thisg.y);       // right-front
-      d4 = ABL_BG_GRID(nextg.x, nextg.y) - z3;  // right-back (delta)
-    }
+    if (prev.y != rel.y || lastg.x != thisg.x) {
 
-    // Bilinear interpolate. Needed since rel.y or thisg.x has changed.
-                L = z1 + d2 * ratio.y;   // Linear interp. LF -> LB
-    const float R = z3 + d4 * ratio.y;   // Linear interp. RF -> RB
+      if (prev.y != rel.y) {
+        prev.y = rel.y;
+        ratio.y = rel.y * ABL_BG_FACTOR(y);
+        const float gy = constrain(FLOOR(ratio.y), 0, ABL_BG_POINTS_Y - (FAR_EDGE_OR_BOX));
+        ratio.y -= gy;
 
-    D = R - L;
-  }
+        #if DISABLED(EXTRAPOLATE_BEYOND_GRID)
+          // Beyond the grid maintain height at grid edges
+          NOLESS(ratio.y, 0); // Never < 0.0. (> 1.0 is ok when nextg.y==thisg.y.)
+        #endif
+
+        thisg.y = gy;
+        nextg.y = _MIN(thisg.y + 1, ABL_BG_POINTS_Y - 1);
+      }
+
+      if (lastg != thisg) {
+        lastg = thisg;
+        // Z at the box corners
+        z1 = ABL_BG_GRID(thisg.x, thisg.y);       // left-front
+        d2 = ABL_BG_GRID(thisg.x, nextg.y) - z1;  // left-back (delta)
+        z3 = ABL_BG_GRID(nextg.x, thisg.y);       // right-front
+        d4 = ABL_BG_GRID(nextg.x, nextg.y) - z3;  // right-back (delta)
+      }
+
+      // Bilinear interpolate. Needed since rel.y or thisg.x has changed.
+                  L = z1 + d2 * ratio.y;   // Linear interp. LF -> LB
+      const float R = z3 + d4 * ratio.y;   // Linear interp. RF -> RB
+
+      D = R - L;
+    }
 
-  const float offset = L + ratio.x * D;   // the offset almost always changes
+    const float offset = L + ratio.x * D;   // the offset almost always changes
 
-  /*
-  static float last_offset = 0;
-  if (ABS(last_offset - offset) > 0.2) {
-    SERIAL_ECHOLNPAIR("Sudden Shift at x=", rel.x, " / ", bilinear_grid_spacing.x, " -> thisg.x=", thisg.x);
-    SERIAL_ECHOLNPAIR(" y=", rel.y, " / ", bilinear_grid_spacing.y, " -> thisg.y=", thisg.y);
-    SERIAL_ECHOLNPAIR(" ratio.x=", ratio.x, " ratio.y=", ratio.y);
-    SERIAL_ECHOLNPAIR(" z1=", z1, " z2=", z2, " z3=", z3, " z4=", z4);
-    SERIAL_ECHOLNPAIR(" L=", L, " R=", R, " offset=", offset);
+    return offset;
   }
-  last_offset = offset;
-  //*/
 
-  return offset;
-}
+#endif
 
-#if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
+#if IS_CARTESIAN && (DISABLED(SEGMENT_LEVELED_MOVES) || HAS_ADAPTIVE_LEVELED_SEGMENTS)
 
   #define CELL_INDEX(A,V) ((V - bilinear_start.A) * ABL_BG_FACTOR(A))
 
+  #if HAS_ADAPTIVE_LEVELED_SEGMENTS
+
+    /**
+     * Move to the destination within a single grid cell. Along a line the
+     * cell surface is a parabola whose chord error is |d * dx * dy| / 4 (in
+     * cell units), so split into just enough segments to keep the error
+     * under LEVELED_SEGMENT_MAX_ERROR. Flat cells get a single move.
+     */
+    static void bilinear_cell_line_to_destination(const feedRate_t &scaled_fr_mm_s, const xy_int_t &c) {
+      const xyze_float_t diff = destination - current_position;
+      const float err = ABS(bilinear_cells[c.x][c.y].d * diff.x * ABL_BG_FACTOR(x) * diff.y * ABL_BG_FACTOR(y)) * 0.25f;
+      if (err > (LEVELED_SEGMENT_MAX_ERROR)) {
+        // The error falls with the square of the number of segments
+        uint16_t segments = CEIL(SQRT(err * RECIPROCAL(LEVELED_SEGMENT_MAX_ERROR)));
+        const xyze_float_t segment_distance = diff * RECIPROCAL(float(segments));
+        xyze_pos_t raw = current_position;
+        while (--segments) {
+          raw += segment_distance;
+          if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder)) break;
+        }
+      }
+      current_position = destination;
+      line_to_current_position(scaled_fr_mm_s);
+    }
+
+    #define CELL_LINE_TO_DESTINATION() bilinear_cell_line_to_destination(scaled_fr_mm_s, c1)
+
+  #else
+
+    #define CELL_LINE_TO_DESTINATION() do{ current_position = destination; line_to_current_position(scaled_fr_mm_s); }while(0)
+
+  #endif
+
   /**
    * Prepare a bilinear-leveled linear move on Cartesian,
    * splitting the move where it crosses grid borders.
@@ -367,8 +451,7 @@ float bilinear_z_offset(const xy_pos_t &raw) {
 
     // Start and end in the same cell? No split needed.
     if (c1 == c2) {
-      current_position = destination;
-      line_to_current_position(scaled_fr_mm_s);
+      CELL_LINE_TO_DESTINATION();
       return;
     }
 
@@ -400,8 +483,7 @@ float bilinear_z_offset(const xy_pos_t &raw) {
     else {
       // Must already have been split on these border(s)
       // This should be a rare case.
-      current_position = destination;
-      line_to_current_position(scaled_fr_mm_s);
+      CELL_LINE_TO_DESTINATION();
       return;
     }
 
@@ -416,6 +498,6 @@ float bilinear_z_offset(const xy_pos_t &raw) {
     bilinear_line_to_destination(scaled_fr_mm_s, x_splits, y_splits);
   }
 
-#endif // IS_CARTESIAN && !SEGMENT_LEVELED_MOVES
+#endif // IS_CARTESIAN && (!SEGMENT_LEVELED_MOVES || HAS_ADAPTIVE_LEVELED_SEGMENTS)
 
 #endif // AUTO_BED_LEVELING_BILINEAR
@@ -27,6 +27,9 @@ extern xy_pos_t bilinear_grid_spacing, bilinear_start;
 extern xy_float_t bilinear_grid_factor;
 extern bed_mesh_t z_values;
 float bilinear_z_offset(const xy_pos_t &raw);
+#if ENABLED(MARLIN_DEV_MODE)
+  float bilinear_z_offset_rows(const xy_pos_t &raw);
+#endif
 
 void extrapolate_unprobed_bed_level();
 void print_bilinear_leveling_grid();
@@ -36,7 +39,7 @@ void refresh_bed_level();
   void bed_level_virt_interpolate();
 #endif
 
-#if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
+#if IS_CARTESIAN && (DISABLED(SEGMENT_LEVELED_MOVES) || HAS_ADAPTIVE_LEVELED_SEGMENTS)
   void bilinear_line_to_destination(const feedRate_t &scaled_fr_mm_s, uint16_t x_splits=0xFFFF, uint16_t y_splits=0xFFFF);
 #endif
 
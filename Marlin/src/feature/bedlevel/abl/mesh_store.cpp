@@ -0,0 +1,238 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/bedlevel/abl/mesh_store.cpp - Bilinear mesh slots in SPI Flash
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if HAS_MESH_SLOTS
+
+#include "mesh_store.h"
+
+#include "../../../libs/W25Qxx.h"
+#include "../../../libs/crc16.h"
+#include "../../../module/temperature.h"
+
+#if ENABLED(EXTENSIBLE_UI)
+  #include "../../../lcd/extui/ui_api.h"
+#endif
+
+MeshStore mesh_store;
+
+#if ENABLED(BILINEAR_MESH_TEMP_BLEND)
+  bool MeshStore::blend_active; // = false
+  int16_t MeshStore::slot_temp[BILINEAR_MESH_SLOTS];
+  uint16_t MeshStore::slot_bits;
+  uint8_t MeshStore::blend_lo, MeshStore::blend_hi;
+  float MeshStore::blend_temp;
+  bed_mesh_t MeshStore::lo_values, MeshStore::delta_values;
+#endif
+
+#define MESH_RECORD_MARKER 0x4D53 // "MS"
+
+// Records start on a page boundary
+#define RECORD_STRIDE (((sizeof(mesh_record_t) + (SPI_FLASH_PageSize) - 1) / (SPI_FLASH_PageSize)) * (SPI_FLASH_PageSize))
+#define RECORDS_PER_SLOT ((SPI_FLASH_SectorSize) / (RECORD_STRIDE))
+#define SLOT_ADDR(S) (uint32_t(MESH_SLOTS_FLASH_ADDR) + uint32_t(S) * (SPI_FLASH_SectorSize))
+
+static_assert(RECORDS_PER_SLOT >= 1, "GRID_MAX_POINTS_X/Y is too large for a mesh slot.");
+
+static uint16_t record_crc(const mesh_record_t &rec) {
+  uint16_t crc = 0;
+  crc16(&crc, &rec.grid_x, sizeof(mesh_record_t) - offsetof(mesh_record_t, grid_x));
+  return crc;
+}
+
+/**
+ * Scan the slot for its newest valid record, leaving it in 'rec'.
+ * Return the index of the first free record, or RECORDS_PER_SLOT if the sector is full.
+ * Set 'rec.marker' to 0 if no valid record was found.
+ */
+uint8_t MeshStore::find_last(const uint8_t slot, mesh_record_t &rec) {
+  mesh_record_t r;
+  bool found = false;
+  uint8_t i = 0;
+  for (; i < RECORDS_PER_SLOT; i++) {
+    W25QXX.SPI_FLASH_BufferRead((uint8_t*)&r, SLOT_ADDR(slot) + i * (RECORD_STRIDE), sizeof(r));
+    if (r.marker == 0xFFFF) break;                  // Erased page, end of records
+    if (r.marker == MESH_RECORD_MARKER && r.crc == record_crc(r)) {
+      rec = r;
+      found = true;
+    }
+  }
+  if (!found) rec.marker = 0;
+  return i;
+}
+
+bool MeshStore::read(const uint8_t slot, mesh_record_t &rec) {
+  if (slot >= BILINEAR_MESH_SLOTS) return false;
+  W25QXX.init(SPI_QUARTER_SPEED);
+  find_last(slot, rec);
+  return rec.marker == MESH_RECORD_MARKER;
+}
+
+bool MeshStore::save(const uint8_t slot) {
+  if (slot >= BILINEAR_MESH_SLOTS || !leveling_is_valid()) return false;
+
+  mesh_record_t rec;
+  rec.marker = MESH_RECORD_MARKER;
+  rec.grid_x = GRID_MAX_POINTS_X;
+  rec.grid_y = GRID_MAX_POINTS_Y;
+  rec.bed_temp = TERN0(HAS_HEATED_BED, thermalManager.degTargetBed());
+  rec.start = bilinear_start;
+  rec.spacing = bilinear_grid_spacing;
+  COPY(rec.z_values, z_values);
+  rec.crc = record_crc(rec);
+
+  W25QXX.init(SPI_QUARTER_SPEED);
+
+  // Append after the last record, erasing the sector only when it's full
+  mesh_record_t last;
+  uint8_t index = find_last(slot, last);
+  if (index >= RECORDS_PER_SLOT) {
+    W25QXX.SPI_FLASH_SectorErase(SLOT_ADDR(slot));
+    index = 0;
+  }
+
+  const uint32_t addr = SLOT_ADDR(slot) + index * (RECORD_STRIDE);
+  W25QXX.SPI_FLASH_BufferWrite((uint8_t*)&rec, addr, sizeof(rec));
+
+  // Verify by reading it back
+  mesh_record_t check;
+  W25QXX.SPI_FLASH_BufferRead((uint8_t*)&check, addr, sizeof(check));
+  return check.marker == MESH_RECORD_MARKER && check.crc == record_crc(check);
+}
+
+bool MeshStore::load(const uint8_t slot) {
+  mesh_record_t rec;
+  if (!read(slot, rec) || rec.grid_x != GRID_MAX_POINTS_X || rec.grid_y != GRID_MAX_POINTS_Y)
+    return false;
+
+  TERN_(BILINEAR_MESH_TEMP_BLEND, blend_stop());
+  set_bed_leveling_enabled(false);
+  bilinear_start = rec.start;
+  bilinear_grid_spacing = rec.spacing;
+  COPY(z_values, rec.z_values);
+  refresh_bed_level();
+  #if ENABLED(EXTENSIBLE_UI)
+    GRID_LOOP(x, y) ExtUI::onMeshUpdate(x, y, z_values[x][y]);
+  #endif
+  return true;
+}
+
+void MeshStore::report() {
+  mesh_record_t rec;
+  LOOP_L_N(s, BILINEAR_MESH_SLOTS) {
+    SERIAL_ECHOPAIR("Mesh slot ", int(s), ": ");
+    if (read(s, rec)) {
+      SERIAL_ECHO(int(rec.grid_x));
+      SERIAL_ECHOLNPAIR("x", int(rec.grid_y), " bed:", rec.bed_temp);
+    }
+    else
+      SERIAL_ECHOLNPGM("empty");
+  }
+}
+
+#if ENABLED(BILINEAR_MESH_TEMP_BLEND)
+
+  #define NO_SLOT 0xFF
+
+  /**
+   * Find the slots usable for blending: the same grid as the first valid slot.
+   * Return false if there are none.
+   */
+  bool MeshStore::blend_start() {
+    mesh_record_t rec, first;
+    slot_bits = 0;
+    LOOP_L_N(s, BILINEAR_MESH_SLOTS) {
+      if (!read(s, rec) || rec.grid_x != GRID_MAX_POINTS_X || rec.grid_y != GRID_MAX_POINTS_Y) continue;
+      if (!slot_bits)
+        first = rec;
+      else if (rec.start != first.start || rec.spacing != first.spacing)
+        continue;
+      SBI(slot_bits, s);
+      slot_temp[s] = rec.bed_temp;
+    }
+    if (!slot_bits) return false;
+
+    blend_lo = blend_hi = NO_SLOT;
+    blend_active = true;
+    blend_task(true);
+    return blend_active;
+  }
+
+  bool MeshStore::load_blend_pair(const uint8_t lo, const uint8_t hi) {
+    mesh_record_t rec;
+    if (!read(hi, rec)) return false;
+    COPY(delta_values, rec.z_values);
+    if (!read(lo, rec)) return false;
+    COPY(lo_values, rec.z_values);
+    GRID_LOOP(x, y) delta_values[x][y] -= lo_values[x][y];
+    bilinear_start = rec.start;
+    bilinear_grid_spacing = rec.spacing;
+    blend_lo = lo;
+    blend_hi = hi;
+    return true;
+  }
+
+  /**
+   * Re-blend the active mesh when the bed temperature has changed by a degree
+   * or more. Only the mesh changes, so bilinear_z_offset costs nothing extra.
+   */
+  void MeshStore::blend_task(const bool force/*=false*/) {
+    if (!blend_active) return;
+
+    static millis_t next_blend_ms = 0;
+    const millis_t ms = millis();
+    if (!force && PENDING(ms, next_blend_ms)) return;
+    next_blend_ms = ms + 1000UL;
+
+    const float t = thermalManager.degBed();
+    if (!force && ABS(t - blend_temp) < 1) return;
+
+    // The closest slots at or below and at or above the bed temperature
+    uint8_t lo = NO_SLOT, hi = NO_SLOT;
+    LOOP_L_N(s, BILINEAR_MESH_SLOTS) {
+      if (!TEST(slot_bits, s)) continue;
+      const int16_t st = slot_temp[s];
+      if (st <= t && (lo == NO_SLOT || st > slot_temp[lo])) lo = s;
+      if (st >= t && (hi == NO_SLOT || st < slot_temp[hi])) hi = s;
+    }
+    if (lo == NO_SLOT) lo = hi;
+    if (hi == NO_SLOT) hi = lo;
+
+    if ((lo != blend_lo || hi != blend_hi) && !load_blend_pair(lo, hi)) {
+      blend_stop();
+      return;
+    }
+
+    const float w = slot_temp[hi] == slot_temp[lo] ? 0 : (t - slot_temp[lo]) / float(slot_temp[hi] - slot_temp[lo]);
+    GRID_LOOP(x, y) z_values[x][y] = lo_values[x][y] + w * delta_values[x][y];
+    refresh_bed_level();
+    blend_temp = t;
+  }
+
+#endif // BILINEAR_MESH_TEMP_BLEND
+
+#endif // HAS_MESH_SLOTS
@@ -0,0 +1,71 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/bedlevel/abl/mesh_store.h - Bilinear mesh slots in SPI Flash
+ */
+
+#include "../bedlevel.h"
+
+typedef struct {
+  uint16_t marker;          // MESH_RECORD_MARKER. Reads 0xFFFF on an erased page.
+  uint16_t crc;             // CRC16 of everything after this field
+  uint8_t grid_x, grid_y;   // Must match GRID_MAX_POINTS_X/Y to be loaded
+  int16_t bed_temp;         // Bed target temperature when the mesh was saved
+  xy_pos_t start, spacing;
+  bed_mesh_t z_values;
+} mesh_record_t;
+
+/**
+ * Each slot owns one SPI Flash sector. New records are appended to the
+ * next free page of the sector and the newest valid record wins, so the
+ * sector is only erased once it fills up.
+ */
+class MeshStore {
+  public:
+    static bool save(const uint8_t slot);
+    static bool load(const uint8_t slot);
+    static bool read(const uint8_t slot, mesh_record_t &rec);
+    static void report();
+
+    #if ENABLED(BILINEAR_MESH_TEMP_BLEND)
+      static bool blend_active;
+      static bool blend_start();
+      static void blend_stop() { blend_active = false; }
+      static void blend_task(const bool force=false);
+    #endif
+
+  private:
+    static uint8_t find_last(const uint8_t slot, mesh_record_t &rec);
+
+    #if ENABLED(BILINEAR_MESH_TEMP_BLEND)
+      static int16_t slot_temp[BILINEAR_MESH_SLOTS];  // Bed temperature of each usable slot
+      static uint16_t slot_bits;                      // Usable slots for blending
+      static uint8_t blend_lo, blend_hi;              // Slots bracketing the bed temperature
+      static float blend_temp;                        // Bed temperature of the current blend
+      static bed_mesh_t lo_values, delta_values;      // The low mesh and (high - low)
+      static bool load_blend_pair(const uint8_t lo, const uint8_t hi);
+    #endif
+};
+
+extern MeshStore mesh_store;
@@ -46,6 +46,10 @@
   #include "../../lcd/extui/ui_api.h"
 #endif
 
+#if ENABLED(BILINEAR_MESH_TEMP_BLEND)
+  #include "abl/mesh_store.h"
+#endif
+
 bool leveling_is_valid() {
   return TERN1(MESH_BED_LEVELING,          mbl.has_mesh())
       && TERN1(AUTO_BED_LEVELING_BILINEAR, !!bilinear_grid_spacing.x)
@@ -129,12 +133,14 @@ void reset_bed_level() {
     #if ENABLED(MESH_BED_LEVELING)
       mbl.reset();
     #elif ENABLED(AUTO_BED_LEVELING_BILINEAR)
+      TERN_(BILINEAR_MESH_TEMP_BLEND, mesh_store.blend_stop());
       bilinear_start.reset();
       bilinear_grid_spacing.reset();
       GRID_LOOP(x, y) {
         z_values[x][y] = NAN;
         TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, 0));
       }
+      refresh_bed_level();
     #elif ABL_PLANAR
       planner.bed_level_matrix.set_to_identity();
     #endif
@@ -30,6 +30,10 @@
 char* SDFileTransferProtocol::Packet::Open::data = nullptr;
 size_t SDFileTransferProtocol::data_waiting, SDFileTransferProtocol::transfer_timeout, SDFileTransferProtocol::idle_timeout;
 bool SDFileTransferProtocol::transfer_active, SDFileTransferProtocol::dummy_transfer, SDFileTransferProtocol::compression;
+#if ENABLED(HAS_BINARY_STREAM_WINDOW)
+  bool SDFileTransferProtocol::write_error;
+  BinaryStream::Slot BinaryStream::slot[BINARY_STREAM_WINDOW];
+#endif
 
 BinaryStream binaryStream[NUM_SERIAL];
 
@@ -39,6 +39,12 @@ inline int bs_read_serial(const uint8_t index) {
 
 #if ENABLED(BINARY_STREAM_COMPRESSION)
   static heatshrink_decoder hsd;
+#endif
+
+#if ENABLED(HAS_BINARY_STREAM_WINDOW)
+  // File data waits here and goes to SD in whole sectors
+  static uint8_t decode_buffer[4 * 512] = {};
+#elif ENABLED(BINARY_STREAM_COMPRESSION)
   static uint8_t decode_buffer[512] = {};
 #endif
 
@@ -70,10 +76,23 @@ private:
     }
     transfer_active = true;
     data_waiting = 0;
+    TERN_(HAS_BINARY_STREAM_WINDOW, write_error = false);
     TERN_(BINARY_STREAM_COMPRESSION, heatshrink_decoder_reset(&hsd));
     return true;
   }
 
+  #if EITHER(BINARY_STREAM_COMPRESSION, HAS_BINARY_STREAM_WINDOW)
+    // Write the whole sectors in decode_buffer and keep the rest
+    static bool flush_sectors() {
+      const size_t count = data_waiting & ~size_t(511);
+      if (!count) return true;
+      if (!dummy_transfer && card.write(decode_buffer, count) < 0) return false;
+      data_waiting -= count;
+      if (data_waiting) memmove(decode_buffer, &decode_buffer[count], data_waiting);
+      return true;
+    }
+  #endif
+
   static bool file_write(char* buffer, const size_t length) {
     #if ENABLED(BINARY_STREAM_COMPRESSION)
       if (compression) {
@@ -86,24 +105,30 @@ private:
           do {
             presult = heatshrink_decoder_poll(&hsd, &decode_buffer[data_waiting], sizeof(decode_buffer) - data_waiting, &processed_count);
             data_waiting += processed_count;
-            if (data_waiting == sizeof(decode_buffer)) {
-              if (!dummy_transfer)
-                if (card.write(decode_buffer, data_waiting) < 0) {
-                  return false;
-                }
-              data_waiting = 0;
-            }
+            if (data_waiting == sizeof(decode_buffer) && !flush_sectors()) return false;
           } while (presult == HSDR_POLL_MORE);
         }
         return true;
       }
     #endif
-    return (dummy_transfer || card.write(buffer, length) >= 0);
+    #if ENABLED(HAS_BINARY_STREAM_WINDOW)
+      // Buffer the data for idle() to write, unless the buffer is full
+      for (size_t done = 0; done < length;) {
+        const size_t count = _MIN(length - done, sizeof(decode_buffer) - data_waiting);
+        memcpy(&decode_buffer[data_waiting], &buffer[done], count);
+        data_waiting += count;
+        done += count;
+        if (data_waiting == sizeof(decode_buffer) && !flush_sectors()) return false;
+      }
+      return true;
+    #else
+      return (dummy_transfer || card.write(buffer, length) >= 0);
+    #endif
   }
 
   static bool file_close() {
     if (!dummy_transfer) {
-      #if ENABLED(BINARY_STREAM_COMPRESSION)
+      #if EITHER(BINARY_STREAM_COMPRESSION, HAS_BINARY_STREAM_WINDOW)
         // flush any buffered data
         if (data_waiting) {
           if (card.write(decode_buffer, data_waiting) < 0) return false;
@@ -119,6 +144,7 @@ private:
   }
 
   static void transfer_abort() {
+    data_waiting = 0;
     if (!dummy_transfer) {
       card.closefile();
       card.removeFile(card.filename);
@@ -133,10 +159,19 @@ private:
 
   static size_t data_waiting, transfer_timeout, idle_timeout;
   static bool transfer_active, dummy_transfer, compression;
+  #if ENABLED(HAS_BINARY_STREAM_WINDOW)
+    static bool write_error;  // A write from idle() failed, report it with the next reply
+  #endif
 
 public:
 
   static void idle() {
+    #if ENABLED(HAS_BINARY_STREAM_WINDOW)
+      // The stream is quiet, so write out the whole sectors received so far
+      if (transfer_active && !write_error && data_waiting >= 512 && !flush_sectors())
+        write_error = true;
+    #endif
+
     // If a transfer is interrupted and a file is left open, abort it after TIMEOUT ms
     const millis_t ms = millis();
     if (transfer_active && ELAPSED(ms, idle_timeout)) {
@@ -174,7 +209,7 @@ public:
         break;
       case FileTransfer::CLOSE:
         if (transfer_active) {
-          if (file_close())
+          if (file_close() && TERN1(HAS_BINARY_STREAM_WINDOW, !write_error))
             SERIAL_ECHOLNPGM("PFT:success");
           else
             SERIAL_ECHOLNPGM("PFT:ioerror");
@@ -184,7 +219,7 @@ public:
       case FileTransfer::WRITE:
         if (!transfer_active)
           SERIAL_ECHOLNPGM("PFT:invalid");
-        else if (!file_write(buffer, length))
+        else if (TERN0(HAS_BINARY_STREAM_WINDOW, write_error) || !file_write(buffer, length))
           SERIAL_ECHOLNPGM("PFT:ioerror");
         break;
       case FileTransfer::ABORT:
@@ -204,7 +239,7 @@ class BinaryStream {
 public:
   enum class Protocol : uint8_t { CONTROL, FILE_TRANSFER };
 
-  enum class ProtocolControl : uint8_t { SYNC = 1, CLOSE };
+  enum class ProtocolControl : uint8_t { SYNC = 1, CLOSE, WINDOW };
 
   enum class StreamState : uint8_t { PACKET_RESET, PACKET_WAIT, PACKET_HEADER, PACKET_DATA, PACKET_FOOTER,
                                      PACKET_PROCESS, PACKET_RESEND, PACKET_TIMEOUT, PACKET_ERROR };
@@ -253,10 +288,24 @@ public:
     }
   } packet{};
 
+  #if ENABLED(HAS_BINARY_STREAM_WINDOW)
+    // Packets that came in ahead of one still missing wait here, in the slot for their sync
+    struct Slot {
+      Packet::Header header;
+      bool received;
+      char data[BINARY_STREAM_PACKET_SIZE];
+    };
+    static Slot slot[BINARY_STREAM_WINDOW];
+
+    static Slot& slot_for(const uint8_t packet_sync) { return slot[packet_sync & (BINARY_STREAM_WINDOW - 1)]; }
+    static void clear_slots() { for (Slot &s : slot) s.received = false; }
+  #endif
+
   void reset() {
     sync = 0;
     packet_retries = 0;
     buffer_next_index = 0;
+    TERN_(HAS_BINARY_STREAM_WINDOW, clear_slots());
   }
 
   // fletchers 16 checksum
@@ -281,6 +330,12 @@ public:
 
   template<const size_t buffer_size>
   void receive(char (&buffer)[buffer_size]) {
+    #if ENABLED(HAS_BINARY_STREAM_WINDOW)
+      UNUSED(buffer);
+      constexpr size_t packet_size = BINARY_STREAM_PACKET_SIZE;
+    #else
+      constexpr size_t packet_size = buffer_size;
+    #endif
     uint8_t data = 0;
     millis_t transfer_window = millis() + RX_TIMESLICE;
 
@@ -325,10 +380,32 @@ public:
             if (packet.header.checksum == packet.header_checksum) {
               // The SYNC control packet is a special case in that it doesn't require the stream sync to be correct
               if (static_cast<Protocol>(packet.header.protocol()) == Protocol::CONTROL && static_cast<ProtocolControl>(packet.header.type()) == ProtocolControl::SYNC) {
-                  SERIAL_ECHOLNPAIR("ss", sync, ",", buffer_size, ",", VERSION_MAJOR, ".", VERSION_MINOR, ".", VERSION_PATCH);
+                  SERIAL_ECHOLNPAIR("ss", sync, ",", packet_size, ",", VERSION_MAJOR, ".", VERSION_MINOR, ".", VERSION_PATCH);
+                  TERN_(HAS_BINARY_STREAM_WINDOW, clear_slots()); // the host sends everything from sync again
                   stream_state = StreamState::PACKET_RESET;
                   break;
               }
+              #if ENABLED(HAS_BINARY_STREAM_WINDOW)
+                if (uint8_t(packet.header.sync - sync) < BINARY_STREAM_WINDOW) {
+                  Slot &s = slot_for(packet.header.sync);
+                  if (s.received) {                                 // ok response must have been lost
+                    SERIAL_ECHOLNPAIR("ok", packet.header.sync);
+                    stream_state = StreamState::PACKET_RESET;
+                  }
+                  else {
+                    buffer_next_index = 0;
+                    packet.bytes_received = 0;
+                    packet.buffer = s.data;
+                    stream_state = packet.header.size ? StreamState::PACKET_DATA : StreamState::PACKET_PROCESS;
+                  }
+                }
+                else if (uint8_t(sync - packet.header.sync) <= BINARY_STREAM_WINDOW) { // already processed, ok must have been lost
+                  SERIAL_ECHOLNPAIR("ok", packet.header.sync);
+                  stream_state = StreamState::PACKET_RESET;
+                }
+                else
+                  stream_state = StreamState::PACKET_RESET; // beyond the window, drop it without ack
+              #else
               if (packet.header.sync == sync) {
                 buffer_next_index = 0;
                 packet.bytes_received = 0;
@@ -350,6 +427,7 @@ public:
                 SERIAL_ECHO_MSG("Datastream packet out of order");
                 stream_state = StreamState::PACKET_RESEND;
               }
+              #endif
             }
             else {
               SERIAL_ECHO_START();
@@ -361,7 +439,7 @@ public:
         case StreamState::PACKET_DATA:
           if (!stream_read(data)) break;
 
-          if (buffer_next_index < buffer_size)
+          if (buffer_next_index < packet_size)
             packet.buffer[buffer_next_index] = data;
           else {
             SERIAL_ECHO_MSG("Datastream packet data buffer overrun");
@@ -389,17 +467,32 @@ public:
             else {
               SERIAL_ECHO_START();
               SERIAL_ECHOLNPAIR("Packet(", packet.header.sync, ") payload corrupt");
-              stream_state = StreamState::PACKET_RESEND;
+              #if ENABLED(HAS_BINARY_STREAM_WINDOW)
+                SERIAL_ECHOLNPAIR("rs", packet.header.sync); // only this one is needed again
+                stream_state = StreamState::PACKET_RESET;
+              #else
+                stream_state = StreamState::PACKET_RESEND;
+              #endif
             }
           }
           break;
         case StreamState::PACKET_PROCESS:
-          sync++;
           packet_retries = 0;
           bytes_received += packet.header.size;
 
           SERIAL_ECHOLNPAIR("ok", packet.header.sync); // transmit valid packet received
-          dispatch();
+          #if ENABLED(HAS_BINARY_STREAM_WINDOW)
+            // Hand over this packet and any that were waiting on it, in order
+            slot_for(packet.header.sync).header = packet.header;
+            slot_for(packet.header.sync).received = true;
+            for (Slot *s; (s = &slot_for(sync))->received; sync++) {
+              s->received = false;
+              dispatch(s->header, s->data);
+            }
+          #else
+            sync++;
+            dispatch(packet.header, packet.buffer);
+          #endif
           stream_state = StreamState::PACKET_RESET;
           break;
         case StreamState::PACKET_RESEND:
@@ -428,19 +521,22 @@ public:
     #pragma GCC diagnostic pop
   }
 
-  void dispatch() {
-    switch (static_cast<Protocol>(packet.header.protocol())) {
+  void dispatch(Packet::Header &header, char *buffer) {
+    switch (static_cast<Protocol>(header.protocol())) {
       case Protocol::CONTROL:
-        switch (static_cast<ProtocolControl>(packet.header.type())) {
+        switch (static_cast<ProtocolControl>(header.type())) {
           case ProtocolControl::CLOSE: // revert back to ASCII mode
             card.flag.binary_mode = false;
             break;
+          case ProtocolControl::WINDOW: // how many packets the host may send ahead
+            SERIAL_ECHOLNPAIR("ws", TERN(HAS_BINARY_STREAM_WINDOW, BINARY_STREAM_WINDOW, 1));
+            break;
           default:
             SERIAL_ECHO_MSG("Unknown BinaryProtocolControl Packet");
         }
         break;
       case Protocol::FILE_TRANSFER:
-        SDFileTransferProtocol::process(packet.header.type(), packet.buffer, packet.header.size); // send user data to be processed
+        SDFileTransferProtocol::process(header.type(), buffer, header.size); // send user data to be processed
       break;
       default:
         SERIAL_ECHO_MSG("Unsupported Binary Protocol");
@@ -452,7 +548,7 @@ public:
     SDFileTransferProtocol::idle();
   }
 
-  static const uint16_t PACKET_MAX_WAIT = 500, RX_TIMESLICE = 20, MAX_RETRIES = 0, VERSION_MAJOR = 0, VERSION_MINOR = 1, VERSION_PATCH = 0;
+  static const uint16_t PACKET_MAX_WAIT = 500, RX_TIMESLICE = 20, MAX_RETRIES = 0, VERSION_MAJOR = 0, VERSION_MINOR = 2, VERSION_PATCH = 0;
   uint8_t  packet_retries, sync;
   uint16_t buffer_next_index;
   uint32_t bytes_received;
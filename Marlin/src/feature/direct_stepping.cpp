@@ -27,6 +27,11 @@
 
 #include "../MarlinCore.h"
 
+#if ENABLED(DIRECT_STEPPING_SD)
+  #include "../sd/cardreader.h"
+  #include "../module/planner.h"
+#endif
+
 #define CHECK_PAGE(I, R) do{                                \
   if (I >= sizeof(page_states) / sizeof(page_states[0])) {  \
     fatal_error = true;                                     \
@@ -208,17 +213,147 @@ namespace DirectStepping {
   }
 
   template <>
-  FORCE_INLINE uint8_t *PageManager::get_page(const page_idx_t page_idx) {
+  FORCE_INLINE uint8_t *SerialPageManager<Config>::get_page(const page_idx_t page_idx) {
     CHECK_PAGE(page_idx, nullptr);
 
     return pages[page_idx];
   }
 
   template <>
-  FORCE_INLINE void PageManager::free_page(const page_idx_t page_idx) {
+  FORCE_INLINE void SerialPageManager<Config>::free_page(const page_idx_t page_idx) {
     set_page_state(page_idx, PageState::FREE);
   }
 
+  #if ENABLED(DIRECT_STEPPING_SD)
+
+    template class SerialPageManager<Config>;
+
+    static SdFile page_file;
+
+    template<typename Cfg>
+    bool SDPageManager<Cfg>::active;
+
+    template<typename Cfg>
+    bool SDPageManager<Cfg>::at_end;
+
+    template<typename Cfg>
+    typename Cfg::page_idx_t SDPageManager<Cfg>::fill_idx;
+
+    template<typename Cfg>
+    typename Cfg::page_idx_t SDPageManager<Cfg>::queue_idx;
+
+    template<typename Cfg>
+    uint16_t SDPageManager<Cfg>::loaded;
+
+    template<typename Cfg>
+    uint16_t SDPageManager<Cfg>::underruns;
+
+    template<typename Cfg>
+    uint32_t SDPageManager<Cfg>::page_count;
+
+    template<typename Cfg>
+    page_record_t SDPageManager<Cfg>::records[Cfg::NUM_PAGES];
+
+    template<typename Cfg>
+    bool SDPageManager<Cfg>::open(const char * const path) {
+      if (!card.isMounted()) {
+        SERIAL_ECHO_MSG(STR_NO_MEDIA);
+        return false;
+      }
+
+      // Let pages from before finish, and take back any a quick stop left behind
+      planner.synchronize();
+      close();
+      for (int i = 0 ; i < Cfg::NUM_PAGES ; i++)
+        Base::page_states[i] = PageState::FREE;
+
+      SdFile *dir;
+      const char * const fname = card.diveToFile(false, dir, path);
+      page_file_header_t header;
+      if (!fname || !page_file.open(dir, fname, O_READ)
+        || page_file.read(&header, sizeof(header)) != int16_t(sizeof(header))
+        || strncmp(header.magic, "G6PG", 4) || header.format != STEPPER_PAGE_FORMAT || header.page_size != Cfg::PAGE_SIZE
+      ) {
+        page_file.close();
+        SERIAL_ECHO_MSG("Can't play pages from ", path);
+        return false;
+      }
+
+      fill_idx = queue_idx = 0;
+      loaded = underruns = 0;
+      page_count = 0;
+      at_end = false;
+      active = true;
+      idle();
+      return true;
+    }
+
+    // Wait for the next page to be read. False at the end of the file, or if it's stopped.
+    template<typename Cfg>
+    bool SDPageManager<Cfg>::next(page_idx_t &page_idx, page_record_t &record) {
+      bool starved = false;
+      while (!loaded) {
+        if (!active || at_end || Base::fatal_error || card.flag.abort_sd_printing) return false;
+        if (!planner.has_blocks_queued()) {
+          // Nothing running and nothing free to read into: the pages were dropped by a quick stop
+          if (Base::page_states[fill_idx] != PageState::FREE) return false;
+          if (page_count && !starved) { starved = true; underruns++; }
+        }
+        ::idle();
+      }
+
+      page_idx = queue_idx;
+      record = records[queue_idx];
+      if (++queue_idx == Cfg::NUM_PAGES) queue_idx = 0;
+      loaded--;
+      page_count++;
+      return true;
+    }
+
+    template<typename Cfg>
+    void SDPageManager<Cfg>::close() {
+      if (!active) return;
+      active = false;
+      page_file.close();
+      SERIAL_ECHO_MSG("Pages played:", page_count, " Underruns:", underruns);
+    }
+
+    // Read ahead into the pages the steppers are done with
+    template<typename Cfg>
+    void SDPageManager<Cfg>::idle() {
+      while (active && !at_end && Base::page_states[fill_idx] == PageState::FREE) {
+        page_record_t &record = records[fill_idx];
+        const int16_t n = page_file.read(&record, sizeof(record));
+        if (n == 0) { at_end = true; return; }
+        if (n != int16_t(sizeof(record)) || !record.step_rate
+          || page_file.read(Base::pages[fill_idx], Cfg::PAGE_SIZE) != Cfg::PAGE_SIZE
+        ) {
+          Base::fatal_error = true; // Killed by write_responses
+          at_end = true;
+          return;
+        }
+        // Not reported to the host, the pages are only used here
+        Base::page_states[fill_idx] = PageState::OK;
+        if (++fill_idx == Cfg::NUM_PAGES) fill_idx = 0;
+        loaded++;
+      }
+    }
+
+    template<typename Cfg>
+    uint8_t *SDPageManager<Cfg>::get_page(const page_idx_t page_idx) {
+      return Base::get_page(page_idx);
+    }
+
+    template<typename Cfg>
+    void SDPageManager<Cfg>::free_page(const page_idx_t page_idx) {
+      if (active)
+        Base::page_states[page_idx] = PageState::FREE;
+      else
+        Base::free_page(page_idx);
+    }
+
+  #endif // DIRECT_STEPPING_SD
+
 };
 
 DirectStepping::PageManager page_manager;
@@ -80,6 +80,55 @@ namespace DirectStepping {
     static void set_page_state(const page_idx_t page_idx, const PageState page_state);
   };
 
+  #if ENABLED(DIRECT_STEPPING_SD)
+
+    /**
+     * A page file starts with this header, then has one record per page,
+     * each followed by PAGE_SIZE bytes of page data. Numbers are little-endian.
+     */
+    struct [[gnu::packed]] page_file_header_t {
+      char magic[4];        // "G6PG"
+      uint8_t format;       // STEPPER_PAGE_FORMAT of the pages
+      uint8_t reserved;
+      uint16_t page_size;   // Bytes per page
+    };
+
+    struct [[gnu::packed]] page_record_t {
+      uint32_t step_rate;   // As G6 R
+      uint16_t steps;       // As G6 S, or 0 for the whole page
+      uint8_t dirs;         // Bits 0-3 set for a positive X, Y, Z, E direction, as G6 X Y Z E
+      uint8_t reserved;
+    };
+
+    // Plays pages from a file on the SD card. Pages from the host still work when no file is playing.
+    template<typename Cfg>
+    class SDPageManager : public SerialPageManager<Cfg> {
+    public:
+
+      typedef typename Cfg::page_idx_t page_idx_t;
+
+      static bool open(const char * const path);
+      static bool next(page_idx_t &page_idx, page_record_t &record);
+      static void close();
+      static void idle();
+
+      static uint8_t *get_page(const page_idx_t page_idx);
+      static void free_page(const page_idx_t page_idx);
+
+    protected:
+
+      typedef SerialPageManager<Cfg> Base;
+
+      static bool active, at_end;
+      static page_idx_t fill_idx, queue_idx;  // Next page to read and to queue
+      static uint16_t loaded,                 // Pages read but not queued
+                      underruns;              // Times the steppers ran out of pages
+      static uint32_t page_count;
+      static page_record_t records[Cfg::NUM_PAGES];
+    };
+
+  #endif
+
   template<bool b, typename T, typename F> struct TypeSelector { typedef T type;} ;
   template<typename T, typename F> struct TypeSelector<false, T, F> { typedef F type; };
 
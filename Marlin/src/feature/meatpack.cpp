@@ -39,10 +39,13 @@
 
 #include "../inc/MarlinConfig.h"
 
-#if ENABLED(MEATPACK)
+#if HAS_MEATPACK
 
 #include "meatpack.h"
-MeatPack meatpack;
+
+#if ENABLED(MEATPACK)
+  MeatPack meatpack;
+#endif
 
 #define MeatPack_ProtocolVersion "PV01"
 //#define MP_DEBUG
@@ -50,17 +53,9 @@ MeatPack meatpack;
 #define DEBUG_OUT ENABLED(MP_DEBUG)
 #include "../core/debug_out.h"
 
-bool MeatPack::cmd_is_next = false;       // A command is pending
-uint8_t MeatPack::state = 0;              // Configuration state OFF
-uint8_t MeatPack::second_char = 0;        // The unpacked 2nd character from an out-of-sequence packed pair
-uint8_t MeatPack::cmd_count = 0,          // Counts how many command bytes are received (need 2)
-        MeatPack::full_char_count = 0,    // Counts how many full-width characters are to be received
-        MeatPack::char_out_count = 0;     // Stores number of characters to be read out.
-uint8_t MeatPack::char_out_buf[2];        // Output buffer for caching up to 2 characters
-
 // The 15 most-common characters used in G-code, ~90-95% of all G-code uses these characters
 // Stored in SRAM for performance.
-uint8_t meatPackLookupTable[16] = {
+static const uint8_t meatPackLookupTable[16] = {
   '0', '1', '2', '3', '4', '5', '6', '7', '8', '9',
   '.', ' ', '\n', 'G', 'X',
   '\0' // Unused. 0b1111 indicates a literal character
@@ -81,6 +76,11 @@ void MeatPack::reset_state() {
  * Return flags indicating whether any literal bytes follow.
  */
 uint8_t MeatPack::unpack_chars(const uint8_t pk, uint8_t* __restrict const chars_out) {
+  // With no spaces 'E' takes the place of ' '
+  auto unpacked = [&](const uint8_t chr) -> uint8_t {
+    return (chr == kSpaceCharIdx && TEST(state, MPConfig_Bit_NoSpaces)) ? kSpaceCharReplace : meatPackLookupTable[chr];
+  };
+
   uint8_t out = 0;
 
   // If lower nybble is 1111, the higher nybble is unused, and next char is full.
@@ -88,7 +88,7 @@ uint8_t MeatPack::unpack_chars(const uint8_t pk, uint8_t* __restrict const chars
     out = kFirstCharIsLiteral;
   else {
     const uint8_t chr = pk & 0x0F;
-    chars_out[0] = meatPackLookupTable[chr]; // Set the first char
+    chars_out[0] = unpacked(chr);         // Set the first char
   }
 
   // Check if upper nybble is 1111... if so, we don't need the second char.
@@ -96,7 +96,7 @@ uint8_t MeatPack::unpack_chars(const uint8_t pk, uint8_t* __restrict const chars
     out |= kSecondCharIsLiteral;
   else {
     const uint8_t chr = (pk >> 4) & 0x0F;
-    chars_out[1] = meatPackLookupTable[chr]; // Set the second char
+    chars_out[1] = unpacked(chr);         // Set the second char
   }
 
   return out;
@@ -164,12 +164,8 @@ void MeatPack::handle_command(const MeatPack_Command c) {
     case MPCommand_EnablePacking:   SBI(state, MPConfig_Bit_Active);   DEBUG_ECHOLNPGM("[MPDBG] ENA REC");   break;
     case MPCommand_DisablePacking:  CBI(state, MPConfig_Bit_Active);   DEBUG_ECHOLNPGM("[MPDBG] DIS REC");   break;
     case MPCommand_ResetAll:        reset_state();                     DEBUG_ECHOLNPGM("[MPDBG] RESET REC"); break;
-    case MPCommand_EnableNoSpaces:
-      SBI(state, MPConfig_Bit_NoSpaces);
-      meatPackLookupTable[kSpaceCharIdx] = kSpaceCharReplace;          DEBUG_ECHOLNPGM("[MPDBG] ENA NSP");   break;
-    case MPCommand_DisableNoSpaces:
-      CBI(state, MPConfig_Bit_NoSpaces);
-      meatPackLookupTable[kSpaceCharIdx] = ' ';                        DEBUG_ECHOLNPGM("[MPDBG] DIS NSP");   break;
+    case MPCommand_EnableNoSpaces:  SBI(state, MPConfig_Bit_NoSpaces); DEBUG_ECHOLNPGM("[MPDBG] ENA NSP");   break;
+    case MPCommand_DisableNoSpaces: CBI(state, MPConfig_Bit_NoSpaces); DEBUG_ECHOLNPGM("[MPDBG] DIS NSP");   break;
     default:                                                           DEBUG_ECHOLNPGM("[MPDBG] UNK CMD REC");
   }
   report_state();
@@ -178,6 +174,12 @@ void MeatPack::handle_command(const MeatPack_Command c) {
 void MeatPack::report_state() {
   // NOTE: if any configuration vars are added below, the outgoing sync text for host plugin
   // should not contain the "PV' substring, as this is used to indicate protocol version
+  if (reply) {
+    char msg[24];
+    sprintf_P(msg, PSTR("[MP] " MeatPack_ProtocolVersion " %s %s\n"),
+      TEST(state, MPConfig_Bit_Active) ? "ON" : "OFF", TEST(state, MPConfig_Bit_NoSpaces) ? "NSP" : "ESP");
+    return reply(msg);
+  }
   SERIAL_ECHOPGM("[MP] ");
   SERIAL_ECHOPGM(MeatPack_ProtocolVersion " ");
   serialprint_onoff(TEST(state, MPConfig_Bit_Active));
@@ -225,4 +227,4 @@ uint8_t MeatPack::get_result_char(char* const __restrict out) {
   return res;
 }
 
-#endif // MEATPACK
+#endif // HAS_MEATPACK
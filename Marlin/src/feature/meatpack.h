@@ -78,9 +78,25 @@ enum MeatPack_ConfigStateBits : uint8_t {
 };
 
 class MeatPack {
-private:
-  friend class GCodeQueue;
+public:
+  // Pass in a character rx'd by SD card or serial. Automatically parses command/ctrl sequences,
+  // and will control state internally.
+  void handle_rx_char(const uint8_t c, const serial_index_t serial_ind);
+
+  /**
+   * After passing in rx'd char using above method, call this to get characters out.
+   * Can return from 0 to 2 characters at once.
+   * @param out [in] Output pointer for unpacked/processed data.
+   * @return Number of characters returned. Range from 0 to 2.
+   */
+  uint8_t get_result_char(char* const __restrict out);
+
+  void reset_state();
+
+  // Send the state reports here instead of to serial
+  void (*reply)(const char * const msg) = nullptr;
 
+private:
   // Utility definitions
   static const uint8_t kCommandByte         = 0b11111111,
                        kFirstNotPacked      = 0b00001111,
@@ -91,33 +107,20 @@ private:
   static const uint8_t kSpaceCharIdx = 11;
   static const char kSpaceCharReplace = 'E';
 
-  static bool cmd_is_next;        // A command is pending
-  static uint8_t state;           // Configuration state
-  static uint8_t second_char;     // Buffers a character if dealing with out-of-sequence pairs
-  static uint8_t cmd_count,       // Counter of command bytes received (need 2)
-                 full_char_count, // Counter for full-width characters to be received
-                 char_out_count;  // Stores number of characters to be read out.
-  static uint8_t char_out_buf[2]; // Output buffer for caching up to 2 characters
-
-  // Pass in a character rx'd by SD card or serial. Automatically parses command/ctrl sequences,
-  // and will control state internally.
-  static void handle_rx_char(const uint8_t c, const serial_index_t serial_ind);
-
-  /**
-   * After passing in rx'd char using above method, call this to get characters out.
-   * Can return from 0 to 2 characters at once.
-   * @param out [in] Output pointer for unpacked/processed data.
-   * @return Number of characters returned. Range from 0 to 2.
-   */
-  static uint8_t get_result_char(char* const __restrict out);
+  // Each stream has its own state
+  bool cmd_is_next = false;       // A command is pending
+  uint8_t state = 0;              // Configuration state
+  uint8_t second_char = 0;        // Buffers a character if dealing with out-of-sequence pairs
+  uint8_t cmd_count = 0,          // Counter of command bytes received (need 2)
+          full_char_count = 0,    // Counter for full-width characters to be received
+          char_out_count = 0;     // Stores number of characters to be read out.
+  uint8_t char_out_buf[2];        // Output buffer for caching up to 2 characters
 
-  static void reset_state();
-  static void report_state();
-  static uint8_t unpacked_char(register const uint8_t in);
-  static uint8_t unpack_chars(const uint8_t pk, uint8_t* __restrict const chars_out);
-  static void handle_command(const MeatPack_Command c);
-  static void handle_output_char(const uint8_t c);
-  static void handle_rx_char_inner(const uint8_t c);
+  void report_state();
+  uint8_t unpack_chars(const uint8_t pk, uint8_t* __restrict const chars_out);
+  void handle_command(const MeatPack_Command c);
+  void handle_output_char(const uint8_t c);
+  void handle_rx_char_inner(const uint8_t c);
 };
 
 extern MeatPack meatpack;
@@ -44,6 +44,15 @@ uint32_t PrintJobRecovery::cmd_sdpos, // = 0
   bool PrintJobRecovery::dwin_flag; // = false
 #endif
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+  uint32_t PrintJobRecovery::journal_first, // = 0
+           PrintJobRecovery::journal_block;
+  uint16_t PrintJobRecovery::journal_used,
+           PrintJobRecovery::journal_epoch;
+  uint8_t PrintJobRecovery::journal_buf[512];
+  job_recovery_info_t PrintJobRecovery::journal_info;
+#endif
+
 #include "../sd/cardreader.h"
 #include "../lcd/marlinui.h"
 #include "../gcode/queue.h"
@@ -54,6 +63,10 @@ uint32_t PrintJobRecovery::cmd_sdpos, // = 0
 #include "../module/temperature.h"
 #include "../core/serial.h"
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+  #include "../libs/crc16.h"
+#endif
+
 #if ENABLED(FWRETRACT)
   #include "fwretract.h"
 #endif
@@ -121,6 +134,7 @@ void PrintJobRecovery::check() {
  */
 void PrintJobRecovery::purge() {
   init();
+  if (TERN0(POWER_LOSS_JOURNAL, journal_end())) return;
   card.removeJobRecoveryFile();
 }
 
@@ -129,9 +143,19 @@ void PrintJobRecovery::purge() {
  */
 void PrintJobRecovery::load() {
   if (exists()) {
-    open(true);
-    (void)file.read(&info, sizeof(info));
-    close();
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      // A file the size of the journal is only replayed, and one that doesn't
+      // replay holds no job. Smaller files are records from before the journal.
+      if (journal_open(false)) {
+        if (!journal_replay()) info.valid_head = info.valid_foot = 0;
+      }
+      else
+    #endif
+    {
+      open(true);
+      (void)file.read(&info, sizeof(info));
+      close();
+    }
   }
   debug(PSTR("Load"));
 }
@@ -142,6 +166,12 @@ void PrintJobRecovery::load() {
 void PrintJobRecovery::prepare() {
   card.getAbsFilename(info.sd_filename);  // SD filename
   cmd_sdpos = 0;
+  #if ENABLED(POWER_LOSS_JOURNAL)
+    // Find the journal again, in case the card was changed. With the outage save
+    // alone, open it now so that save is only the one block write.
+    journal_first = 0;
+    TERN_(POWER_LOSS_RESUME_AT_COMMAND, journal_open(true));
+  #endif
 }
 
 /**
@@ -272,17 +302,25 @@ void PrintJobRecovery::save(const bool force/*=false*/, const float zraise/*=0*/
    * An outage was detected by a sensor pin.
    *  - If not SD printing, let the machine turn off on its own with no "KILL" screen
    *  - Disable all heaters first to save energy
+   *  - With POWER_LOSS_RESUME_AT_COMMAND stop the steppers, so the saved position
+   *    is where the nozzle is and the saved sdpos the command that put it there
    *  - Save the recovery data for the current instant
    *  - If backup power is available Retract E and Raise Z
    *  - Go to the KILL screen
    */
   void PrintJobRecovery::_outage() {
-    #if ENABLED(BACKUP_POWER_SUPPLY)
+    #if EITHER(BACKUP_POWER_SUPPLY, POWER_LOSS_RESUME_AT_COMMAND)
       static bool lock = false;
-      if (lock) return; // No re-entrance from idle() during retract_and_lift()
+      if (lock) return; // No re-entrance from idle() during quickstop_stepper() or retract_and_lift()
       lock = true;
     #endif
 
+    #if ENABLED(POWER_LOSS_RESUME_AT_COMMAND)
+      // Drop the planned moves. The stepper ISR leaves info.sdpos at the command of the
+      // last block it ran, so resuming replays only the commands since, from here.
+      quickstop_stepper();
+    #endif
+
     #if POWER_LOSS_ZRAISE
       // Get the limited Z-raise to do now or on resume
       const float zraise = _MAX(0, _MIN(current_position.z + POWER_LOSS_ZRAISE, Z_MAX_POS - 1) - current_position.z);
@@ -315,6 +353,8 @@ void PrintJobRecovery::write() {
 
   debug(PSTR("Write"));
 
+  if (TERN0(POWER_LOSS_JOURNAL, journal_append())) return;
+
   open(false);
   file.seekSet(0);
   const int16_t ret = file.write(&info, sizeof(info));
@@ -322,6 +362,165 @@ void PrintJobRecovery::write() {
   if (!file.close()) DEBUG_ECHOLNPGM("Power-loss file close failed.");
 }
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+
+  /**
+   * Journal: /PLR is preallocated as a contiguous file and written as raw
+   * SD blocks, so a save costs a single block write with no FAT, directory
+   * or open/close traffic. Each save appends a record of the bytes of info
+   * that changed since the last one, as runs of (offset, length, data).
+   * The block being filled is rewritten as records are added.
+   *
+   * The record at the start of the journal, or any delta that would be as
+   * big, holds all of info (a base). When the blocks are used up the journal
+   * starts over at the first block with a base of a new epoch, which ends it
+   * before the stale records that follow. At the end of a print the first
+   * block gets an end mark, keeping the epoch and the file's blocks.
+   *
+   * On load the records are replayed up to the first that doesn't belong:
+   * an empty slot, another epoch or a bad CRC. A block torn by an outage
+   * takes its records with it, leaving the state of the block before.
+   */
+  #define JOURNAL_BASE  0xB5
+  #define JOURNAL_DELTA 0xD5
+  #define JOURNAL_END   0xE5
+
+  typedef struct {
+    uint8_t tag, reserved;
+    uint16_t epoch,
+             size,          // Bytes after the header
+             crc;           // CRC16 of those bytes
+  } journal_record_t;
+
+  bool PrintJobRecovery::journal_open(const bool create) {
+    if (!card.jobRecoveryJournal(journal_first, POWER_LOSS_JOURNAL_BLOCKS * 512UL, create)) return (journal_first = 0);
+    // Carry on from the epoch of the first block, so the old records can't pass for new ones
+    journal_record_t rec;
+    if (card.getSd2Card().readBlock(journal_first, journal_buf)) {
+      memcpy(&rec, journal_buf, sizeof(rec));
+      journal_epoch = rec.epoch;
+    }
+    journal_block = journal_first;
+    journal_used = 0;
+    return true;
+  }
+
+  // The changed bytes of info as runs of (offset, length, data). Only the size without 'out'.
+  uint16_t PrintJobRecovery::journal_delta(uint8_t *out) {
+    const uint8_t * const now = (uint8_t*)&info, * const was = (uint8_t*)&journal_info;
+    uint16_t size = 0;
+    for (uint16_t i = 0; i < sizeof(info);) {
+      if (now[i] == was[i]) { i++; continue; }
+      // Bridge gaps too short to be worth a run header of their own
+      uint16_t end = i + 1;
+      for (uint16_t j = end; j < sizeof(info) && j - i < 255 && j - end < 3; j++)
+        if (now[j] != was[j]) end = j + 1;
+      const uint8_t len = end - i;
+      if (out) {
+        out[size] = i & 0xFF;
+        out[size + 1] = i >> 8;
+        out[size + 2] = len;
+        memcpy(&out[size + 3], &now[i], len);
+      }
+      size += 3 + len;
+      i = end;
+    }
+    return size;
+  }
+
+  bool PrintJobRecovery::journal_append() {
+    static_assert(sizeof(journal_record_t) + sizeof(info) <= sizeof(journal_buf), "job_recovery_info_t is too big for POWER_LOSS_JOURNAL.");
+
+    if (!journal_first && !journal_open(true)) return false;
+
+    uint16_t size = journal_delta(nullptr);
+    if (journal_used + sizeof(journal_record_t) + _MIN(size, sizeof(info)) > sizeof(journal_buf)) {
+      // On to the next block, or start over
+      journal_used = 0;
+      if (++journal_block >= journal_first + (POWER_LOSS_JOURNAL_BLOCKS)) journal_block = journal_first;
+    }
+    if (!journal_used) ZERO(journal_buf);
+
+    const bool start = journal_block == journal_first && !journal_used;
+    if (start) journal_epoch++;
+
+    journal_record_t rec = { JOURNAL_DELTA, 0, journal_epoch, size, 0 };
+    uint8_t * const data = &journal_buf[journal_used + sizeof(rec)];
+    if (start || size >= sizeof(info)) {
+      rec.tag = JOURNAL_BASE;
+      rec.size = sizeof(info);
+      memcpy(data, &info, sizeof(info));
+    }
+    else
+      journal_delta(data);
+    crc16(&rec.crc, data, rec.size);
+    memcpy(&journal_buf[journal_used], &rec, sizeof(rec));
+
+    if (!card.getSd2Card().writeBlock(journal_block, journal_buf)) {
+      DEBUG_ECHOLNPGM("Power-loss journal write failed.");
+      return (journal_first = 0);
+    }
+    journal_used += sizeof(rec) + rec.size;
+    journal_info = info;
+    return true;
+  }
+
+  // Replay the journal opened by journal_open
+  bool PrintJobRecovery::journal_replay() {
+    bool based = false;
+    for (uint32_t b = journal_first; b < journal_first + (POWER_LOSS_JOURNAL_BLOCKS); b++) {
+      if (!card.getSd2Card().readBlock(b, journal_buf)) break;
+      for (uint16_t i = 0; i + sizeof(journal_record_t) <= sizeof(journal_buf);) {
+        journal_record_t rec;
+        memcpy(&rec, &journal_buf[i], sizeof(rec));
+        if (!rec.tag) break;  // The rest of the block is empty
+        const uint8_t * const data = &journal_buf[i + sizeof(rec)];
+        uint16_t crc = 0;
+        if (i + sizeof(rec) + rec.size > sizeof(journal_buf)) return based;
+        crc16(&crc, data, rec.size);
+        if (crc != rec.crc || (based && rec.epoch != journal_epoch)) return based;
+        if (rec.tag == JOURNAL_BASE && rec.size == sizeof(info)) {
+          memcpy(&info, data, sizeof(info));
+          journal_epoch = rec.epoch;
+          based = true;
+        }
+        else if (based && rec.tag == JOURNAL_DELTA) {
+          for (uint16_t r = 0; r + 3 <= rec.size;) {
+            const uint16_t offset = data[r] | (data[r + 1] << 8);
+            const uint8_t len = data[r + 2];
+            if (offset + len > sizeof(info) || r + 3 + len > rec.size) return based;
+            memcpy((uint8_t*)&info + offset, &data[r + 3], len);
+            r += 3 + len;
+          }
+        }
+        else
+          return based;
+        i += sizeof(rec) + rec.size;
+      }
+      if (!based) break;
+    }
+    return based;
+  }
+
+  // Mark the journal ended, keeping the file and its epoch for the next print
+  bool PrintJobRecovery::journal_end() {
+    if (!journal_first && !(exists() && journal_open(false))) return false;
+    journal_block = journal_first;
+    journal_used = 0;
+    // Every boot without an outage purges, so skip the write if it's already ended
+    journal_record_t rec;
+    if (card.getSd2Card().readBlock(journal_first, journal_buf)) {
+      memcpy(&rec, journal_buf, sizeof(rec));
+      if (rec.tag == JOURNAL_END) return true;
+    }
+    ZERO(journal_buf);
+    rec = { JOURNAL_END, 0, journal_epoch, 0, 0 };
+    memcpy(journal_buf, &rec, sizeof(rec));
+    return card.getSd2Card().writeBlock(journal_first, journal_buf);
+  }
+
+#endif // POWER_LOSS_JOURNAL
+
 /**
  * Resume the saved print job
  */
@@ -178,6 +178,21 @@ class PrintJobRecovery {
   private:
     static void write();
 
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      static uint32_t journal_first,          //!< First SD block of /PLR, or 0 until opened
+                      journal_block;          //!< Block being filled
+      static uint16_t journal_used,           //!< Bytes of journal_buf in use
+                      journal_epoch;          //!< Tag of the records since the last base at the start
+      static uint8_t journal_buf[512];
+      static job_recovery_info_t journal_info; //!< The info as the journal has it
+
+      static bool journal_open(const bool create);
+      static bool journal_append();
+      static bool journal_replay();
+      static bool journal_end();
+      static uint16_t journal_delta(uint8_t *out);
+    #endif
+
     #if ENABLED(BACKUP_POWER_SUPPLY)
       static void retract_and_lift(const float &zraise);
     #endif
@@ -0,0 +1,170 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/status_snapshot.cpp - Preformatted printer status for hosts
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(STATUS_SNAPSHOT)
+
+#include "status_snapshot.h"
+
+#include "../MarlinCore.h"
+#include "../module/motion.h"
+#include "../module/planner.h"
+#include "../module/temperature.h"
+#include "../lcd/marlinui.h"
+
+#if ENABLED(SDSUPPORT)
+  #include "../sd/cardreader.h"
+#endif
+
+StatusSnapshot status_snapshot;
+
+#define HEATERS_STR_SIZE (24 * (4 + 2 * (HOTENDS)))
+#define STATUS_STR_SIZE  (160 + 16 * (2 * (HOTENDS) + EXTRUDERS + FAN_COUNT))
+
+uint8_t StatusSnapshot::stamp; // = 0
+char StatusSnapshot::heaters_str[HEATERS_STR_SIZE],
+     StatusSnapshot::status_str[STATUS_STR_SIZE];
+
+static millis_t next_refresh_ms; // = 0
+
+#ifdef SERIAL_FLOAT_PRECISION
+  #define SFP _MIN(SERIAL_FLOAT_PRECISION, 2)
+#else
+  #define SFP 2
+#endif
+
+char* StatusSnapshot::append_float(char *p, const float f, const uint8_t dec/*=2*/) {
+  const int16_t scale = dec >= 2 ? 100 : dec ? 10 : 1;
+  int32_t v = LROUND(f * scale);
+  if (v < 0) { *p++ = '-'; v = -v; }
+  p += sprintf_P(p, PSTR("%ld"), long(v / scale));
+  if (dec) p += sprintf_P(p, dec >= 2 ? PSTR(".%02ld") : PSTR(".%ld"), long(v % scale));
+  return p;
+}
+
+#if HAS_TEMP_SENSOR
+
+  // Same as print_heater_state: " T:c /t", " B:c /t", " T1:c /t"...
+  static char* append_heater(char *p, const char k, const int8_t e, const float c, const float t) {
+    *p++ = ' ';
+    *p++ = k;
+    if (e >= 0) *p++ = '0' + e;
+    *p++ = ':';
+    p = StatusSnapshot::append_float(p, c, SFP);
+    *p++ = ' ';
+    *p++ = '/';
+    return StatusSnapshot::append_float(p, t, SFP);
+  }
+
+  // Same fields as Temperature::print_heater_states(active_extruder)
+  static void format_heaters(char *p) {
+    #if HAS_TEMP_HOTEND
+      p = append_heater(p, 'T', -1, thermalManager.degHotend(active_extruder), thermalManager.degTargetHotend(active_extruder));
+    #endif
+    #if HAS_HEATED_BED
+      p = append_heater(p, 'B', -1, thermalManager.degBed(), thermalManager.degTargetBed());
+    #endif
+    #if HAS_TEMP_CHAMBER
+      p = append_heater(p, 'C', -1, thermalManager.degChamber(), TERN0(HAS_HEATED_CHAMBER, thermalManager.degTargetChamber()));
+    #endif
+    #if HAS_TEMP_PROBE
+      p = append_heater(p, 'P', -1, thermalManager.degProbe(), 0);
+    #endif
+    #if HAS_MULTI_HOTEND
+      HOTEND_LOOP() p = append_heater(p, 'T', e, thermalManager.degHotend(e), thermalManager.degTargetHotend(e));
+    #endif
+    p += sprintf_P(p, PSTR(" @:%d"), thermalManager.getHeaterPower((heater_id_t)active_extruder));
+    #if HAS_HEATED_BED
+      p += sprintf_P(p, PSTR(" B@:%d"), thermalManager.getHeaterPower(H_BED));
+    #endif
+    #if HAS_HEATED_CHAMBER
+      p += sprintf_P(p, PSTR(" C@:%d"), thermalManager.getHeaterPower(H_CHAMBER));
+    #endif
+    #if HAS_MULTI_HOTEND
+      HOTEND_LOOP() p += sprintf_P(p, PSTR(" @%d:%d"), e, thermalManager.getHeaterPower((heater_id_t)e));
+    #endif
+    *p = '\0';
+  }
+
+#endif // HAS_TEMP_SENSOR
+
+/**
+ * A subset of RepRapFirmware's M408 S0 reply, e.g.:
+ * {"status":"P","heaters":[60.00,210.00],"active":[60.00,210.00],"pos":[10.00,20.00,0.30],
+ *  "sfactor":100,"efactor":[100],"fanPercent":[100],"fraction_printed":0.42}
+ * Heater 0 is the bed, as in RRF. The position is that of the last planned move.
+ */
+static void format_status(char *p) {
+  p += sprintf_P(p, PSTR("{\"status\":\"%c\""), printingIsPaused() ? 'S' : printingIsActive() ? 'P' : 'I');
+
+  const float bed = TERN0(HAS_HEATED_BED, thermalManager.degBed()),
+              bed_target = TERN0(HAS_HEATED_BED, thermalManager.degTargetBed());
+  p += sprintf_P(p, PSTR(",\"heaters\":["));
+  p = StatusSnapshot::append_float(p, bed);
+  #if HAS_HOTEND
+    HOTEND_LOOP() { *p++ = ','; p = StatusSnapshot::append_float(p, thermalManager.degHotend(e)); }
+  #endif
+  p += sprintf_P(p, PSTR("],\"active\":["));
+  p = StatusSnapshot::append_float(p, bed_target);
+  #if HAS_HOTEND
+    HOTEND_LOOP() { *p++ = ','; p = StatusSnapshot::append_float(p, thermalManager.degTargetHotend(e)); }
+  #endif
+
+  const xyz_pos_t lpos = current_position.asLogical();
+  p += sprintf_P(p, PSTR("],\"pos\":["));
+  LOOP_XYZ(a) {
+    if (a) *p++ = ',';
+    p = StatusSnapshot::append_float(p, lpos[a]);
+  }
+
+  p += sprintf_P(p, PSTR("],\"sfactor\":%d,\"efactor\":["), feedrate_percentage);
+  LOOP_L_N(e, EXTRUDERS) p += sprintf_P(p, e ? PSTR(",%d") : PSTR("%d"), planner.flow_percentage[e]);
+
+  p += sprintf_P(p, PSTR("],\"fanPercent\":["));
+  #if HAS_FAN
+    LOOP_L_N(f, FAN_COUNT) p += sprintf_P(p, f ? PSTR(",%d") : PSTR("%d"), ui8_to_percent(thermalManager.fan_speed[f]));
+  #endif
+
+  p += sprintf_P(p, PSTR("],\"fraction_printed\":"));
+  // The UI progress includes M73. Without a display only the SD position is known.
+  p = StatusSnapshot::append_float(p, TERN(HAS_DISPLAY, ui.get_progress_percent(), TERN0(SDSUPPORT, card.percentDone())) * 0.01f);
+  *p++ = '}';
+  *p = '\0';
+}
+
+void StatusSnapshot::refresh() {
+  const millis_t ms = millis();
+  if (stamp && PENDING(ms, next_refresh_ms)) return;
+  next_refresh_ms = ms + STATUS_SNAPSHOT_MS;
+
+  TERN_(HAS_TEMP_SENSOR, format_heaters(heaters_str));
+  format_status(status_str);
+
+  if (!++stamp) stamp = 1;  // 0 means "never refreshed"
+}
+
+#endif // STATUS_SNAPSHOT
@@ -0,0 +1,55 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/status_snapshot.h - Preformatted printer status for hosts
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+/**
+ * The temperatures, position, progress, fan and flow are read and formatted
+ * on the first request after STATUS_SNAPSHOT_MS has passed. Until then M105,
+ * the temperature auto-report, M408 and the WiFi module send every client
+ * the same text, so polling hosts cost no float printing.
+ */
+class StatusSnapshot {
+  public:
+    static uint8_t stamp;   // Changes with each refresh
+
+    static void refresh();
+
+    // M105 text after "ok", for the active extruder
+    static const char* heaters() { refresh(); return heaters_str; }
+
+    // M408 line
+    static const char* status() { refresh(); return status_str; }
+
+    // Append a float with up to 2 decimals, printed as integers
+    static char* append_float(char *p, const float f, const uint8_t dec=2);
+
+  private:
+    static char heaters_str[], status_str[];
+};
+
+extern StatusSnapshot status_snapshot;
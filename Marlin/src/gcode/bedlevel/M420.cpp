@@ -37,6 +37,10 @@
   #include "../../lcd/extui/ui_api.h"
 #endif
 
+#if HAS_MESH_SLOTS
+  #include "../../feature/bedlevel/abl/mesh_store.h"
+#endif
+
 //#define M420_C_USE_MEAN
 
 /**
@@ -51,12 +55,24 @@
  *   L[index]  Load UBL mesh from index (0 is default)
  *   T[map]    0:Human-readable 1:CSV 2:"LCD" 4:Compact
  *
+ * With BILINEAR_MESH_SLOTS only:
+ *
+ *   L[slot]   Load the mesh from an SPI Flash slot. List the slots with no value.
+ *   W[slot]   Save the current mesh to an SPI Flash slot
+ *
+ * With BILINEAR_MESH_TEMP_BLEND only:
+ *
+ *   B[bool]   Blend the saved meshes to suit the bed temperature. Editing a mesh point
+ *             stops blending. M500 saves the mesh as it is currently blended.
+ *
  * With mesh-based leveling only:
  *
  *   C         Center mesh on the mean of the lowest and highest
  *
  * With MARLIN_DEV_MODE:
  *   S2        Create a simple random mesh and enable
+ *   S3        Time bilinear_z_offset() against the row interpolation it replaced, for nearby
+ *             and for scattered points (bilinear only)
  */
 void GcodeSuite::M420() {
   const bool seen_S = parser.seen('S'),
@@ -71,10 +87,12 @@ void GcodeSuite::M420() {
         bilinear_grid_spacing.set((x_max - x_min) / (GRID_MAX_POINTS_X - 1),
                                   (y_max - y_min) / (GRID_MAX_POINTS_Y - 1));
       #endif
+      TERN_(BILINEAR_MESH_TEMP_BLEND, mesh_store.blend_stop());
       GRID_LOOP(x, y) {
         Z_VALUES(x, y) = 0.001 * random(-200, 200);
         TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, Z_VALUES(x, y)));
       }
+      TERN_(AUTO_BED_LEVELING_BILINEAR, refresh_bed_level());
       SERIAL_ECHOPGM("Simulated " STRINGIFY(GRID_MAX_POINTS_X) "x" STRINGIFY(GRID_MAX_POINTS_Y) " mesh ");
       SERIAL_ECHOPAIR(" (", x_min);
       SERIAL_CHAR(','); SERIAL_ECHO(y_min);
@@ -82,6 +100,31 @@ void GcodeSuite::M420() {
       SERIAL_CHAR(','); SERIAL_ECHO(y_max);
       SERIAL_ECHOLNPGM(")");
     }
+    #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+      else if (parser.intval('S') == 3) {
+        // Points along a diagonal stay in a cell like the segments of a move. Corner to corner changes cell every time.
+        // The row interpolation that the cell coefficients replaced is timed on the same points.
+        constexpr uint16_t count = 1000;
+        const xy_pos_t lo = { probe.min_x(), probe.min_y() }, hi = { probe.max_x(), probe.max_y() },
+                       step = (hi - lo) / count;
+        float (* const z_offset[])(const xy_pos_t&) = { bilinear_z_offset_rows, bilinear_z_offset };
+        uint32_t near_us[2], far_us[2];
+        volatile float sink = 0;
+        LOOP_L_N(f, 2) {
+          xy_pos_t pos = lo;
+          uint32_t us = micros();
+          for (uint16_t i = 0; i < count; i++, pos += step) sink = sink + z_offset[f](pos);
+          near_us[f] = micros() - us;
+          us = micros();
+          for (uint16_t i = 0; i < count; i++) sink = sink + z_offset[f](i & 1 ? hi : lo);
+          far_us[f] = micros() - us;
+        }
+        #define CYCLES(US) (uint32_t(US) * (F_CPU / 1000000UL) / count)
+        SERIAL_ECHOLNPAIR("bilinear_z_offset cycles per call, rows / cells: nearby ", CYCLES(near_us[0]), " / ", CYCLES(near_us[1]),
+                          " scattered ", CYCLES(far_us[0]), " / ", CYCLES(far_us[1]));
+        return;
+      }
+    #endif
   #endif
 
   xyz_pos_t oldpos = current_position;
@@ -133,6 +176,37 @@ void GcodeSuite::M420() {
 
   #endif // AUTO_BED_LEVELING_UBL
 
+  #if HAS_MESH_SLOTS
+
+    #if ENABLED(BILINEAR_MESH_TEMP_BLEND)
+      if (parser.seen('B')) {
+        if (!parser.value_bool())
+          mesh_store.blend_stop();
+        else if (!mesh_store.blend_start()) {
+          SERIAL_ECHOLNPGM("?No meshes to blend.");
+          return;
+        }
+      }
+    #endif
+
+    if (parser.seen('W')) {
+      if (!mesh_store.save(parser.value_byte())) {
+        SERIAL_ECHOLNPGM("?Mesh not saved.");
+        return;
+      }
+    }
+
+    if (parser.seen('L')) {
+      if (!parser.has_value())
+        mesh_store.report();
+      else if (!mesh_store.load(parser.value_byte())) {
+        SERIAL_ECHOLNPGM("?Mesh slot empty or invalid.");
+        return;
+      }
+    }
+
+  #endif
+
   const bool seenV = parser.seen('V');
 
   #if HAS_MESH
@@ -178,7 +252,7 @@ void GcodeSuite::M420() {
               Z_VALUES(x, y) -= zmean;
               TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, Z_VALUES(x, y)));
             }
-            TERN_(ABL_BILINEAR_SUBDIVISION, bed_level_virt_interpolate());
+            TERN_(AUTO_BED_LEVELING_BILINEAR, refresh_bed_level());
           }
 
         #endif
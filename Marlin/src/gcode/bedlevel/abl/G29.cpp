@@ -72,6 +72,10 @@
   #include "../../../lcd/extui/lib/mks_ui/draw_ui.h"
 #endif
 
+#if ENABLED(BILINEAR_MESH_TEMP_BLEND)
+  #include "../../../feature/bedlevel/abl/mesh_store.h"
+#endif
+
 #if ABL_GRID
   #if ENABLED(PROBE_Y_FIRST)
     #define PR_OUTER_VAR meshCount.x
@@ -310,8 +314,9 @@ G29_TYPE GcodeSuite::G29() {
         }
         if (WITHIN(i, 0, GRID_MAX_POINTS_X - 1) && WITHIN(j, 0, GRID_MAX_POINTS_Y)) {
           set_bed_leveling_enabled(false);
+          TERN_(BILINEAR_MESH_TEMP_BLEND, mesh_store.blend_stop());
           z_values[i][j] = rz;
-          TERN_(ABL_BILINEAR_SUBDIVISION, bed_level_virt_interpolate());
+          refresh_bed_level();
           TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(i, j, rz));
           set_bed_leveling_enabled(abl_should_enable);
           if (abl_should_enable) report_current_position();
@@ -432,6 +437,9 @@ G29_TYPE GcodeSuite::G29() {
     // Be formal so G29 can be done successively without G28.
     if (!no_action) set_bed_leveling_enabled(false);
 
+    // Stop blending saved meshes into the one being probed
+    TERN_(BILINEAR_MESH_TEMP_BLEND, if (!dryrun) mesh_store.blend_stop());
+
     // Deploy certain probes before starting probing
     #if HAS_BED_PROBE
       if (ENABLED(BLTOUCH))
@@ -618,6 +626,13 @@ G29_TYPE GcodeSuite::G29() {
 
       xy_int8_t meshCount;
 
+      #if ENABLED(G29_FAST_APPROACH)
+        // Height predicted for the next point, and the last measured height
+        float expected_z = NAN, last_z = NAN;
+      #else
+        constexpr float expected_z = NAN;
+      #endif
+
       // Outer loop is X with PROBE_Y_FIRST enabled
       // Outer loop is Y with PROBE_Y_FIRST disabled
       for (PR_OUTER_VAR = 0; PR_OUTER_VAR < PR_OUTER_END && !isnan(measured_z); PR_OUTER_VAR++) {
@@ -654,7 +669,7 @@ G29_TYPE GcodeSuite::G29() {
           if (verbose_level) SERIAL_ECHOLNPAIR("Probing mesh point ", int(pt_index), "/", abl_points, ".");
           TERN_(HAS_DISPLAY, ui.status_printf_P(0, PSTR(S_FMT " %i/%i"), GET_TEXT(MSG_PROBING_MESH), int(pt_index), int(abl_points)));
 
-          measured_z = faux ? 0.001f * random(-100, 101) : probe.probe_at_point(probePos, raise_after, verbose_level);
+          measured_z = faux ? 0.001f * random(-100, 101) : probe.probe_at_point(probePos, raise_after, verbose_level, true, true, expected_z);
 
           if (isnan(measured_z)) {
             set_bed_leveling_enabled(abl_should_enable);
@@ -662,6 +677,14 @@ G29_TYPE GcodeSuite::G29() {
             break; // Breaks out of both loops
           }
 
+          #if ENABLED(G29_FAST_APPROACH)
+            // Points are probed in a zig-zag, so the next point is always a neighbor.
+            // Extrapolate along the row, or expect the same height on a new row.
+            const bool row_end = PR_INNER_VAR + inInc == inStop;
+            expected_z = (row_end || PR_INNER_VAR == inStart) ? measured_z : 2 * measured_z - last_z;
+            last_z = measured_z;
+          #endif
+
           #if ENABLED(PROBE_TEMP_COMPENSATION)
             temp_comp.compensate_measurement(TSI_BED, thermalManager.degBed(), measured_z);
             temp_comp.compensate_measurement(TSI_PROBE, thermalManager.degProbe(), measured_z);
@@ -35,6 +35,10 @@
   #include "../../../lcd/extui/ui_api.h"
 #endif
 
+#if ENABLED(BILINEAR_MESH_TEMP_BLEND)
+  #include "../../../feature/bedlevel/abl/mesh_store.h"
+#endif
+
 /**
  * M421: Set one or more Mesh Bed Leveling Z coordinates
  *
@@ -56,13 +60,15 @@ void GcodeSuite::M421() {
       const float zval = parser.value_linear_units();
       uint8_t sx = ix >= 0 ? ix : 0, ex = ix >= 0 ? ix : GRID_MAX_POINTS_X - 1,
               sy = iy >= 0 ? iy : 0, ey = iy >= 0 ? iy : GRID_MAX_POINTS_Y - 1;
+      // Keep the next blend step from overwriting the edit
+      TERN_(BILINEAR_MESH_TEMP_BLEND, mesh_store.blend_stop());
       LOOP_S_LE_N(x, sx, ex) {
         LOOP_S_LE_N(y, sy, ey) {
           z_values[x][y] = zval + (hasQ ? z_values[x][y] : 0);
           TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, z_values[x][y]));
         }
       }
-      TERN_(ABL_BILINEAR_SUBDIVISION, bed_level_virt_interpolate());
+      refresh_bed_level();
     }
     else
       SERIAL_ERROR_MSG(STR_ERR_MESH_XY);
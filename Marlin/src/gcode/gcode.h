@@ -210,6 +210,7 @@
  * M405 - Enable Filament Sensor flow control. "M405 D<delay_cm>". (Requires FILAMENT_WIDTH_SENSOR)
  * M406 - Disable Filament Sensor flow control. (Requires FILAMENT_WIDTH_SENSOR)
  * M407 - Display measured filament diameter in millimeters. (Requires FILAMENT_WIDTH_SENSOR)
+ * M408 - Report the printer status in one JSON line. (Requires STATUS_SNAPSHOT)
  * M410 - Quickstop. Abort all planned moves.
  * M412 - Enable / Disable Filament Runout Detection. (Requires FILAMENT_RUNOUT_SENSOR)
  * M413 - Enable / Disable Power-Loss Recovery. (Requires POWER_LOSS_RECOVERY)
@@ -285,9 +286,11 @@
  * ************ Custom codes - This can change to suit future G-code regulations
  * G425 - Calibrate using a conductive object. (Requires CALIBRATION_GCODE)
  * M928 - Start SD logging: "M928 filename.gco". Stop with M29. (Requires SDSUPPORT)
+ * M990 - Report the time taken by each stage of startup. (Requires BOOT_STAGE_TIMING)
  * M993 - Backup SPI Flash to SD
  * M994 - Load a Backup from SD to SPI Flash
  * M995 - Touch screen calibration for TFT display
+ * M996 - Report UI render and cache statistics. (Requires HAS_UI_STATS)
  * M997 - Perform in-application firmware update
  * M999 - Restart after being stopped by error
  * D... - Custom Development G-code. Add hooks to 'gcode_D.cpp' for developers to test features. (Requires MARLIN_DEV_MODE)
@@ -749,6 +752,8 @@ private:
     static void M407();
   #endif
 
+  TERN_(STATUS_SNAPSHOT, static void M408());
+
   TERN_(HAS_FILAMENT_SENSOR, static void M412());
 
   TERN_(HAS_MULTI_LANGUAGE, static void M414());
@@ -877,7 +882,10 @@ private:
 
   TERN_(MAGNETIC_PARKING_EXTRUDER, static void M951());
 
+  TERN_(BOOT_STAGE_TIMING, static void M990());
+
   TERN_(TOUCH_SCREEN_CALIBRATION, static void M995());
+  TERN_(HAS_UI_STATS, static void M996());
 
   #if BOTH(HAS_SPI_FLASH, SDSUPPORT)
     static void M993();
@@ -0,0 +1,38 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(STATUS_SNAPSHOT)
+
+#include "../gcode.h"
+#include "../../feature/status_snapshot.h"
+
+/**
+ * M408: Report the printer status in one JSON line, a subset of
+ *       RepRapFirmware's M408 S0. The text is refreshed at most
+ *       every STATUS_SNAPSHOT_MS.
+ */
+void GcodeSuite::M408() {
+  SERIAL_ECHOLN(status_snapshot.status());
+}
+
+#endif // STATUS_SNAPSHOT
@@ -0,0 +1,48 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if HAS_UI_STATS
+
+#include "../gcode.h"
+
+#if HAS_TFT_LVGL_UI
+  #include "../../lcd/extui/lib/mks_ui/draw_ui.h"
+#elif ENABLED(TFT_DAMAGE_TRACKING)
+  #include "../../lcd/tft/tft.h"
+#endif
+
+/**
+ * M996: Report UI render and cache statistics
+ *   LVGL: heap usage, screen and glyph caches
+ *   TFT_COLOR_UI: pixels redrawn per second, widgets drawn and skipped as unchanged
+ *   WiFi: upload receive ring use, ESP holds and overruns
+ */
+void GcodeSuite::M996() {
+  TERN_(LVGL_SCREEN_CACHE, lv_heap_report());
+  TERN_(LVGL_GLYPH_CACHE, lv_glyph_cache_report());
+  TERN_(TFT_DAMAGE_TRACKING, tft.queue.report());
+  TERN_(MKS_WIFI_DMA_RX, wifi_rx_report());
+}
+
+#endif // HAS_UI_STATS
@@ -30,8 +30,27 @@
 
 /**
  * G6: Direct Stepper Move
+ *
+ * With DIRECT_STEPPING_SD:
+ *   G6 !/path/to/pages - Play all the pages in a file on the SD card, then continue
  */
 void GcodeSuite::G6() {
+  #if ENABLED(DIRECT_STEPPING_SD)
+    if (parser.string_arg && !parser.seen('I')) {
+      if (!page_manager.open(parser.string_arg)) return;
+      page_idx_t page_idx;
+      DirectStepping::page_record_t record;
+      while (page_manager.next(page_idx, record)) {
+        planner.last_page_step_rate = record.step_rate;
+        LOOP_XYZE(i) planner.last_page_dir[i] = TEST(record.dirs, i);
+        planner.buffer_page(page_idx, 0, record.steps ? record.steps : DirectStepping::Config::TOTAL_STEPS);
+        reset_stepper_timeout();
+      }
+      page_manager.close();
+      return;
+    }
+  #endif
+
   // TODO: feedrate support?
   if (parser.seen('R'))
     planner.last_page_step_rate = parser.value_ulong();
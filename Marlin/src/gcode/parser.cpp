@@ -268,9 +268,9 @@ void GCodeParser::parse(char *p) {
   string_arg = nullptr;
   while (const char param = uppercase(*p++)) {  // Get the next parameter. A NUL ends the loop
 
-    // Special handling for M32 [P] !/path/to/file.g#
+    // Special handling for M32 [P] !/path/to/file.g# and G6 !/path/to/pages
     // The path must be the last parameter
-    if (param == '!' && is_command('M', 32)) {
+    if (param == '!' && (is_command('M', 32) || TERN0(DIRECT_STEPPING_SD, is_command('G', 6)))) {
       string_arg = p;                           // Name starts after '!'
       char * const lb = strchr(p, '#');         // Already seen '#' as SD char (to pause buffering)
       if (lb) *lb = '\0';                       // Safe to mark the end of the filename
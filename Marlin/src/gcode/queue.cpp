@@ -451,6 +451,7 @@ void GCodeQueue::get_serial_commands() {
       /**
        * For binary stream file transfer, use serial_line_buffer as the working
        * receive buffer (which limits the packet size to MAX_CMD_SIZE).
+       * With BINARY_STREAM_WINDOW the stream has its own packet buffers instead.
        * The receive buffer also limits the packet size for reliable transmission.
        */
       binaryStream[card.transfer_port_index].receive(serial_line_buffer[card.transfer_port_index]);
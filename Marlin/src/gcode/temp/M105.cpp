@@ -23,6 +23,11 @@
 #include "../gcode.h"
 #include "../../module/temperature.h"
 
+#if ENABLED(STATUS_SNAPSHOT)
+  #include "../../feature/status_snapshot.h"
+  #include "../../module/motion.h"
+#endif
+
 /**
  * M105: Read hot end and bed temperature
  */
@@ -35,6 +40,11 @@ void GcodeSuite::M105() {
 
   #if HAS_TEMP_SENSOR
 
+    #if ENABLED(STATUS_SNAPSHOT)
+      if (target_extruder == active_extruder && !TERN0(TEMP_SENSOR_1_AS_REDUNDANT, parser.boolval('R')))
+        return SERIAL_ECHOLN(status_snapshot.heaters());
+    #endif
+
     thermalManager.print_heater_states(target_extruder
       #if ENABLED(TEMP_SENSOR_1_AS_REDUNDANT)
         , parser.boolval('R')
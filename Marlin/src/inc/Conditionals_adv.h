@@ -150,6 +150,14 @@
   #define HAS_PRINT_PROGRESS 1
 #endif
 
+#if EITHER(MEATPACK, MKS_WIFI_MEATPACK)
+  #define HAS_MEATPACK 1
+#endif
+
+#if ENABLED(BINARY_FILE_TRANSFER) && defined(BINARY_STREAM_WINDOW)
+  #define HAS_BINARY_STREAM_WINDOW 1
+#endif
+
 #if ENABLED(SDSUPPORT) && SD_PROCEDURE_DEPTH
   #define HAS_MEDIA_SUBCALLS 1
 #endif
@@ -467,7 +475,7 @@
     #define STEPPER_PAGE_FORMAT SP_4x2_256
   #endif
   #ifndef PAGE_MANAGER
-    #define PAGE_MANAGER SerialPageManager
+    #define PAGE_MANAGER TERN(DIRECT_STEPPING_SD, SDPageManager, SerialPageManager)
   #endif
 #endif
 
@@ -497,7 +505,7 @@
 #endif
 
 // Flag if an EEPROM type is pre-selected
-#if ENABLED(EEPROM_SETTINGS) && NONE(I2C_EEPROM, SPI_EEPROM, QSPI_EEPROM, FLASH_EEPROM_EMULATION, SRAM_EEPROM_EMULATION, SDCARD_EEPROM_EMULATION)
+#if ENABLED(EEPROM_SETTINGS) && NONE(I2C_EEPROM, SPI_EEPROM, QSPI_EEPROM, FLASH_EEPROM_EMULATION, SRAM_EEPROM_EMULATION, SDCARD_EEPROM_EMULATION, SPI_FLASH_EEPROM_EMULATION)
   #define NO_EEPROM_SELECTED 1
 #endif
 
@@ -46,7 +46,7 @@
 #if ENABLED(EEPROM_SETTINGS)
   // EEPROM type may be defined by compile flags, configs, HALs, or pins
   // Set additional flags to let HALs choose in their Conditionals_post.h
-  #if ANY(FLASH_EEPROM_EMULATION, SRAM_EEPROM_EMULATION, SDCARD_EEPROM_EMULATION, QSPI_EEPROM)
+  #if ANY(FLASH_EEPROM_EMULATION, SRAM_EEPROM_EMULATION, SDCARD_EEPROM_EMULATION, SPI_FLASH_EEPROM_EMULATION, QSPI_EEPROM)
     #define USE_EMULATED_EEPROM 1
   #elif ANY(I2C_EEPROM, SPI_EEPROM)
     #define USE_WIRED_EEPROM    1
@@ -62,6 +62,7 @@
   #undef SDCARD_EEPROM_EMULATION
   #undef SRAM_EEPROM_EMULATION
   #undef FLASH_EEPROM_EMULATION
+  #undef SPI_FLASH_EEPROM_EMULATION
   #undef IIC_BL24CXX_EEPROM
 #endif
 
@@ -2506,6 +2507,23 @@
 #if ENABLED(SEGMENT_LEVELED_MOVES) && !defined(LEVELED_SEGMENT_LENGTH)
   #define LEVELED_SEGMENT_LENGTH 5
 #endif
+#if BOTH(SEGMENT_LEVELED_MOVES, AUTO_BED_LEVELING_BILINEAR) && defined(LEVELED_SEGMENT_MAX_ERROR)
+  #define HAS_ADAPTIVE_LEVELED_SEGMENTS 1
+#endif
+#if ENABLED(AUTO_BED_LEVELING_BILINEAR) && BILINEAR_MESH_SLOTS > 0
+  #define HAS_MESH_SLOTS 1
+  #ifndef MESH_SLOTS_FLASH_ADDR
+    #define MESH_SLOTS_FLASH_ADDR (SPI_FLASH_SIZE - 0x10000) // Last 64K block of SPI Flash
+  #endif
+#endif
+#if ENABLED(SPI_FLASH_EEPROM_EMULATION)
+  #ifndef SPI_FLASH_EEPROM_ADDR
+    #define SPI_FLASH_EEPROM_ADDR (SPI_FLASH_SIZE - 0x20000) // The 64K block below the mesh slots
+  #endif
+  #ifndef SPI_FLASH_EEPROM_SIZE
+    #define SPI_FLASH_EEPROM_SIZE 0x10000
+  #endif
+#endif
 
 /**
  * Default mesh area is an area with an inset margin on the print area.
@@ -2740,6 +2758,11 @@
   #endif
 #endif
 
+// Render and cache statistics of the UI, reported by M996
+#if ANY(LVGL_SCREEN_CACHE, LVGL_GLYPH_CACHE, TFT_DAMAGE_TRACKING, MKS_WIFI_DMA_RX)
+  #define HAS_UI_STATS 1
+#endif
+
 #if BUTTONS_EXIST(EN1, EN2, ENC)
   #define HAS_ROTARY_ENCODER 1
 #endif
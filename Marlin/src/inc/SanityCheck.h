@@ -1508,6 +1508,33 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #error "MESH_EDIT_GFX_OVERLAY requires AUTO_BED_LEVELING_UBL and a Graphical LCD."
 #endif
 
+#if HAS_MESH_SLOTS
+  #if !HAS_SPI_FLASH
+    #error "BILINEAR_MESH_SLOTS requires a board with SPI Flash (HAS_SPI_FLASH)."
+  #elif BILINEAR_MESH_SLOTS > 16
+    #error "BILINEAR_MESH_SLOTS is limited to 16."
+  #endif
+#endif
+
+#if ENABLED(BILINEAR_MESH_TEMP_BLEND)
+  #if !HAS_MESH_SLOTS
+    #error "BILINEAR_MESH_TEMP_BLEND requires BILINEAR_MESH_SLOTS."
+  #elif !HAS_HEATED_BED
+    #error "BILINEAR_MESH_TEMP_BLEND requires a heated bed."
+  #endif
+#endif
+
+#if ENABLED(G29_FAST_APPROACH)
+  #if NONE(AUTO_BED_LEVELING_LINEAR, AUTO_BED_LEVELING_BILINEAR)
+    #error "G29_FAST_APPROACH requires AUTO_BED_LEVELING_LINEAR or AUTO_BED_LEVELING_BILINEAR."
+  #elif TOTAL_PROBING == 2
+    #error "G29_FAST_APPROACH does nothing with TOTAL_PROBING == 2, where the first probe is the fast approach."
+  #elif Z_PROBE_SPEED_FAST == Z_PROBE_SPEED_SLOW
+    #error "G29_FAST_APPROACH requires Z_PROBE_SPEED_FAST to differ from Z_PROBE_SPEED_SLOW."
+  #endif
+  static_assert(G29_FAST_APPROACH_MARGIN > 0, "G29_FAST_APPROACH_MARGIN must be greater than 0.");
+#endif
+
 #if ENABLED(G29_RETRY_AND_RECOVER)
   #if ENABLED(AUTO_BED_LEVELING_UBL)
     #error "G29_RETRY_AND_RECOVER is not compatible with UBL."
@@ -2261,11 +2288,22 @@ static_assert(hbm[Z_AXIS] >= 0, "HOMING_BUMP_MM.Z must be greater than or equal
     + ENABLED(SDCARD_EEPROM_EMULATION) \
     + ENABLED(FLASH_EEPROM_EMULATION) \
     + ENABLED(SRAM_EEPROM_EMULATION) \
+    + ENABLED(SPI_FLASH_EEPROM_EMULATION) \
     + ENABLED(IIC_BL24CXX_EEPROM)
     #error "Please select only one method of EEPROM Persistent Storage."
   #endif
 #endif
 
+#if ENABLED(SPI_FLASH_EEPROM_EMULATION)
+  #if !HAS_SPI_FLASH
+    #error "SPI_FLASH_EEPROM_EMULATION requires a board with SPI Flash (HAS_SPI_FLASH)."
+  #elif SPI_FLASH_EEPROM_ADDR + SPI_FLASH_EEPROM_SIZE > SPI_FLASH_SIZE
+    #error "SPI_FLASH_EEPROM_ADDR + SPI_FLASH_EEPROM_SIZE is beyond the end of the SPI Flash."
+  #elif HAS_MESH_SLOTS && SPI_FLASH_EEPROM_ADDR < MESH_SLOTS_FLASH_ADDR + 0x10000 && MESH_SLOTS_FLASH_ADDR < SPI_FLASH_EEPROM_ADDR + SPI_FLASH_EEPROM_SIZE
+    #error "SPI_FLASH_EEPROM_ADDR overlaps the BILINEAR_MESH_SLOTS."
+  #endif
+#endif
+
 /**
  * Make sure features that need to write to the SD card can
  */
@@ -2288,6 +2326,14 @@ static_assert(hbm[Z_AXIS] >= 0, "HOMING_BUMP_MM.Z must be greater than or equal
   #endif
 #endif
 
+#if ENABLED(POWER_LOSS_JOURNAL) && !WITHIN(POWER_LOSS_JOURNAL_BLOCKS, 2, 4096)
+  #error "POWER_LOSS_JOURNAL_BLOCKS must be from 2 to 4096."
+#endif
+
+#if ENABLED(POWER_LOSS_RESUME_AT_COMMAND) && !PIN_EXISTS(POWER_LOSS)
+  #error "POWER_LOSS_RESUME_AT_COMMAND requires a POWER_LOSS_PIN."
+#endif
+
 /**
  * Make sure only one display is enabled
  */
@@ -2382,6 +2428,54 @@ static_assert(hbm[Z_AXIS] >= 0, "HOMING_BUMP_MM.Z must be greater than or equal
   #error "(FMSC|SPI)TFT_LVGL_UI requires TFT_RES_480x320."
 #endif
 
+#if ENABLED(LVGL_DMA_FLUSH) && !(HAS_TFT_LVGL_UI_SPI && defined(__STM32F1__))
+  #error "LVGL_DMA_FLUSH requires TFT_LVGL_UI with an SPI TFT on STM32F1."
+#endif
+
+#if ENABLED(LVGL_THUMB_CACHE) && !(HAS_TFT_LVGL_UI && BOTH(SDSUPPORT, HAS_SPI_FLASH))
+  #error "LVGL_THUMB_CACHE requires TFT_LVGL_UI, SDSUPPORT and an SPI Flash."
+#endif
+
+#if ENABLED(LVGL_HEATSHRINK_ASSETS) && !(HAS_TFT_LVGL_UI && HAS_SPI_FLASH)
+  #error "LVGL_HEATSHRINK_ASSETS requires TFT_LVGL_UI and an SPI Flash."
+#endif
+
+#if ENABLED(LVGL_SCREEN_CACHE) && !HAS_TFT_LVGL_UI
+  #error "LVGL_SCREEN_CACHE requires TFT_LVGL_UI."
+#endif
+
+#if ENABLED(LVGL_GLYPH_CACHE)
+  #if !HAS_TFT_LVGL_UI
+    #error "LVGL_GLYPH_CACHE requires TFT_LVGL_UI."
+  #elif !WITHIN(LVGL_GLYPH_CACHE_SIZE, 2, 255)
+    #error "LVGL_GLYPH_CACHE_SIZE must be from 2 to 255."
+  #endif
+#endif
+
+#if ENABLED(LVGL_DEFERRED_INIT) && !HAS_TFT_LVGL_UI
+  #error "LVGL_DEFERRED_INIT requires TFT_LVGL_UI."
+#endif
+
+#if ENABLED(MKS_WIFI_COMPRESSED_UPLOAD) && DISABLED(MKS_WIFI_MODULE)
+  #error "MKS_WIFI_COMPRESSED_UPLOAD requires MKS_WIFI_MODULE."
+#endif
+
+#if ENABLED(MKS_WIFI_DMA_RX) && !(ENABLED(MKS_WIFI_MODULE) && defined(__STM32F1__))
+  #error "MKS_WIFI_DMA_RX requires MKS_WIFI_MODULE on STM32F1."
+#endif
+
+#if ENABLED(MKS_WIFI_MEATPACK) && DISABLED(MKS_WIFI_MODULE)
+  #error "MKS_WIFI_MEATPACK requires MKS_WIFI_MODULE."
+#endif
+
+#if BOTH(STATUS_SNAPSHOT, SHOW_TEMP_ADC_VALUES)
+  #error "STATUS_SNAPSHOT is not compatible with SHOW_TEMP_ADC_VALUES."
+#endif
+
+#if ENABLED(TFT_DAMAGE_TRACKING) && DISABLED(TFT_COLOR_UI)
+  #error "TFT_DAMAGE_TRACKING requires TFT_COLOR_UI."
+#endif
+
 #if defined(GRAPHICAL_TFT_UPSCALE) && !WITHIN(GRAPHICAL_TFT_UPSCALE, 2, 3)
   #error "GRAPHICAL_TFT_UPSCALE must be set to 2 or 3."
 #endif
@@ -3263,6 +3357,8 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
  */
 #if BOTH(DIRECT_STEPPING, LIN_ADVANCE)
   #error "DIRECT_STEPPING is incompatible with LIN_ADVANCE. Enable in external planner if possible."
+#elif ENABLED(DIRECT_STEPPING_SD) && DISABLED(SDSUPPORT)
+  #error "DIRECT_STEPPING_SD requires SDSUPPORT."
 #endif
 
 /**
@@ -3309,6 +3405,14 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
   #error "Either enable MEATPACK or enable BINARY_FILE_TRANSFER."
 #endif
 
+#if ENABLED(HAS_BINARY_STREAM_WINDOW)
+  #if !WITHIN(BINARY_STREAM_WINDOW, 2, 128) || (BINARY_STREAM_WINDOW & (BINARY_STREAM_WINDOW - 1))
+    #error "BINARY_STREAM_WINDOW must be a power of 2 from 2 to 128."
+  #elif !WITHIN(BINARY_STREAM_PACKET_SIZE, 64, 4096)
+    #error "BINARY_STREAM_PACKET_SIZE must be from 64 to 4096."
+  #endif
+#endif
+
 /**
  * Sanity check for valid stepper driver types
  */
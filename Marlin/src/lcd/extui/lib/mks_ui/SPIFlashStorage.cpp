@@ -33,6 +33,8 @@ uint8_t SPIFlashStorage::m_pageData[SPI_FLASH_PageSize];
 uint32_t SPIFlashStorage::m_currentPage;
 uint16_t SPIFlashStorage::m_pageDataUsed;
 uint32_t SPIFlashStorage::m_startAddress;
+uint8_t SPIFlashStorage::m_nextPageData[SPI_FLASH_PageSize];
+uint32_t SPIFlashStorage::m_nextPageAddress = UINT32_MAX;
 
 #if HAS_SPI_FLASH_COMPRESSION
 
@@ -144,7 +146,13 @@ uint32_t SPIFlashStorage::m_startAddress;
 
 #endif // HAS_SPI_FLASH_COMPRESSION
 
+#if ENABLED(LVGL_HEATSHRINK_ASSETS)
+  heatshrink_decoder SPIFlashStorage::m_hsd;
+  bool SPIFlashStorage::m_heatshrink;
+#endif
+
 void SPIFlashStorage::beginWrite(uint32_t startAddress) {
+  m_nextPageAddress = UINT32_MAX;
   m_pageDataUsed = 0;
   m_currentPage = 0;
   m_startAddress = startAddress;
@@ -172,7 +180,17 @@ void SPIFlashStorage::savePage(uint8_t* buffer) {
 }
 
 void SPIFlashStorage::loadPage(uint8_t* buffer) {
-  W25QXX.SPI_FLASH_BufferRead(buffer, m_startAddress + (SPI_FLASH_PageSize * m_currentPage), SPI_FLASH_PageSize);
+  const uint32_t address = m_startAddress + (SPI_FLASH_PageSize * m_currentPage);
+  if (address == m_nextPageAddress) {
+    W25QXX.SPI_FLASH_ReadWait();
+    memcpy(buffer, m_nextPageData, SPI_FLASH_PageSize);
+  }
+  else
+    W25QXX.SPI_FLASH_BufferRead(buffer, address, SPI_FLASH_PageSize);
+
+  // Reads are sequential, so fetch the next page while this one is used
+  m_nextPageAddress = address + SPI_FLASH_PageSize;
+  W25QXX.SPI_FLASH_BufferReadAsync(m_nextPageData, m_nextPageAddress, SPI_FLASH_PageSize);
 }
 
 void SPIFlashStorage::flushPage() {
@@ -212,7 +230,32 @@ void SPIFlashStorage::flushPage() {
   m_currentPage++;
 }
 
+#if ENABLED(LVGL_HEATSHRINK_ASSETS)
+
+  // Decode a full page, pulling in compressed pages as the decoder wants them
+  void SPIFlashStorage::inflatePage() {
+    size_t filled = 0, count;
+    for (;;) {
+      heatshrink_decoder_poll(&m_hsd, m_pageData + filled, SPI_FLASH_PageSize - filled, &count);
+      filled += count;
+      if (filled == SPI_FLASH_PageSize) break;
+      if (compressedDataFree() == 0) {
+        loadPage(m_compressedData);
+        m_currentPage++;
+        m_compressedDataUsed = 0;
+      }
+      heatshrink_decoder_sink(&m_hsd, m_compressedData + m_compressedDataUsed, compressedDataFree(), &count);
+      m_compressedDataUsed += count;
+    }
+    m_pageDataUsed = 0;
+  }
+
+#endif
+
 void SPIFlashStorage::readPage() {
+  #if ENABLED(LVGL_HEATSHRINK_ASSETS)
+    if (m_heatshrink) return inflatePage();
+  #endif
   #if HAS_SPI_FLASH_COMPRESSION
     if (compressedDataFree() == 0) {
       loadPage(m_compressedData);
@@ -273,6 +316,14 @@ void SPIFlashStorage::beginRead(uint32_t startAddress) {
   #if HAS_SPI_FLASH_COMPRESSION
     m_compressedDataUsed = sizeof(m_compressedData);
   #endif
+  #if ENABLED(LVGL_HEATSHRINK_ASSETS)
+    // The first page is needed either way, so look for the tag in it
+    loadPage(m_compressedData);
+    m_currentPage++;
+    m_heatshrink = isHeatshrink(m_compressedData);
+    m_compressedDataUsed = m_heatshrink ? 4 : 0;
+    if (m_heatshrink) heatshrink_decoder_reset(&m_hsd);
+  #endif
 }
 
 uint16_t SPIFlashStorage::outData(uint8_t* data, uint16_t size) {
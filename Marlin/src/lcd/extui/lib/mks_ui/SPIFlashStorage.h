@@ -25,6 +25,11 @@
 
 #define HAS_SPI_FLASH_COMPRESSION 1
 
+#if ENABLED(LVGL_HEATSHRINK_ASSETS)
+  #include "../../../../libs/heatshrink/heatshrink_decoder.h"
+  #define SPI_FLASH_HEATSHRINK_TAG "HS84" // Window 8, lookahead 4, as in heatshrink_config.h
+#endif
+
 /**
  * This class manages and optimizes SPI Flash data storage,
  * keeping an internal buffer to write and save full SPI flash
@@ -61,6 +66,10 @@
  *    while (there is data to read)
  *      SPIFlashStorage.readData(myBuffer, bufferSize);
  *
+ * While a page is being used the next one is already coming in by DMA,
+ * so SPI Flash reads overlap with decompression and with the drawing
+ * done by the caller.
+ *
  * Compression:
  *
  * The biggest advantage of this class is the RLE compression.
@@ -71,6 +80,15 @@
  * The same goes for reading: A compressed page is read from SPI
  * flash, and the data is uncompressed as needed to provide the
  * requested amount of data.
+ *
+ * Heatshrink:
+ *
+ * With LVGL_HEATSHRINK_ASSETS an asset may be compressed on the host
+ * and stored as-is. Such data starts with SPI_FLASH_HEATSHRINK_TAG
+ * and beginRead() switches to the heatshrink decoder when it sees it:
+ *
+ *    heatshrink -e -w 8 -l 4 img_set.bin img_set.hs
+ *    (printf HS84; cat img_set.hs) > assets/img_set.bin
  */
 class SPIFlashStorage {
 public:
@@ -85,6 +103,10 @@ public:
 
   static uint32_t getCurrentPage() { return m_currentPage; }
 
+  #if ENABLED(LVGL_HEATSHRINK_ASSETS)
+    static bool isHeatshrink(const uint8_t* data) { return !memcmp(data, SPI_FLASH_HEATSHRINK_TAG, 4); }
+  #endif
+
 private:
   static void flushPage();
   static void savePage(uint8_t* buffer);
@@ -98,11 +120,18 @@ private:
   static uint16_t m_pageDataUsed;
   static inline uint16_t pageDataFree() { return SPI_FLASH_PageSize - m_pageDataUsed; }
   static uint32_t m_startAddress;
+  static uint8_t m_nextPageData[SPI_FLASH_PageSize];
+  static uint32_t m_nextPageAddress;
   #if HAS_SPI_FLASH_COMPRESSION
     static uint8_t m_compressedData[SPI_FLASH_PageSize];
     static uint16_t m_compressedDataUsed;
     static inline uint16_t compressedDataFree() { return SPI_FLASH_PageSize - m_compressedDataUsed; }
   #endif
+  #if ENABLED(LVGL_HEATSHRINK_ASSETS)
+    static heatshrink_decoder m_hsd;
+    static bool m_heatshrink;
+    static void inflatePage();
+  #endif
 };
 
 extern SPIFlashStorage SPIFlash;
@@ -73,10 +73,7 @@ void TFT::LCD_clear(uint16_t color) {
 void TFT::LCD_Draw_Logo() {
   #if HAS_LOGO_IN_FLASH
     setWindow(0, 0, TFT_WIDTH, TFT_HEIGHT);
-    for (uint16_t i = 0; i < (TFT_HEIGHT); i ++) {
-      Pic_Logo_Read((uint8_t *)"", (uint8_t *)bmp_public_buf, (TFT_WIDTH) * 2);
-      tftio.WriteSequence((uint16_t *)bmp_public_buf, TFT_WIDTH);
-    }
+    Pic_Logo_Stream();
   #endif
 }
 
@@ -122,6 +122,17 @@ static void event_handler(lv_obj_t *obj, lv_event_t event) {
 }
 
 void lv_draw_extrusion(void) {
+  #if ENABLED(LVGL_SCREEN_CACHE)
+    if ((scr = lv_screen_reuse(EXTRUSION_UI))) {
+      disp_ext_type();
+      disp_ext_step();
+      disp_ext_speed();
+      disp_hotend_temp();
+      disp_extru_amount();
+      return;
+    }
+  #endif
+
   scr = lv_screen_create(EXTRUSION_UI);
   // Create image buttons
   lv_obj_t *buttonAdd = lv_big_button_create(scr, "F:/bmp_in.bin", extrude_menu.in, INTERVAL_V, titleHeight, event_handler, ID_E_ADD);
@@ -260,6 +271,7 @@ void lv_clear_extrusion() {
   #if HAS_ROTARY_ENCODER
     if (gCfgItems.encoder_enable) lv_group_remove_all_objs(g);
   #endif
+  if (TERN0(LVGL_SCREEN_CACHE, lv_screen_keep(scr, EXTRUSION_UI))) return;
   lv_obj_del(scr);
 }
 
@@ -220,6 +220,24 @@ void refresh_pos(lv_task_t *)
   disp_cur_pos();
 }
 void lv_draw_move_motor(void) {
+  #if ENABLED(LVGL_SCREEN_CACHE)
+    // The first page has a "more" button only when idle
+    const uint8_t variant = TERN0(MIXWARE_MODEL_V, uiCfg.para_ui_page | (uiCfg.print_state == IDLE) << 1);
+    if ((scr = lv_screen_reuse(MOVE_MOTOR_UI, variant))) {
+      #if ENABLED(MIXWARE_MODEL_V)
+        if (!uiCfg.para_ui_page) {
+          disp_move_axis();
+          disp_move_dist();
+        }
+      #else
+        updatePosTask = lv_task_create(refresh_pos, 300, LV_TASK_PRIO_LOWEST, 0);
+        disp_move_dist();
+      #endif
+      disp_cur_pos();
+      return;
+    }
+  #endif
+
   scr = lv_screen_create(MOVE_MOTOR_UI);
 
   #if ENABLED(MIXWARE_MODEL_V)
@@ -361,6 +379,7 @@ void lv_clear_move_motor() {
   #if DISABLED(MIXWARE_MODEL_V)
     lv_task_del(updatePosTask);
   #endif
+  if (TERN0(LVGL_SCREEN_CACHE, lv_screen_keep(scr, MOVE_MOTOR_UI))) return;
   lv_obj_del(scr);
 }
 
@@ -439,9 +439,31 @@ int ascii2dec_test(char *ascii) {
   return result;
 }
 
+/**
+ * Decode 2 * bytes hex digits from src into dst, four digits per 32-bit
+ * word. A digit's value is its low nibble, plus 9 when bit 6 marks a
+ * letter, which holds for both cases. Thumbnails are all valid hex, so
+ * unlike ascii2dec_test() other characters aren't mapped to 0.
+ */
+void hex_decode(uint8_t *dst, const char *src, const uint16_t bytes) {
+  uint16_t n = bytes;
+  for (; n >= 2; n -= 2, src += 4, dst += 2) {
+    uint32_t w;
+    memcpy(&w, src, sizeof(w));                           // Digits d0..d3, d0 in the low byte
+    w = (w & 0x0F0F0F0F) + ((w >> 6) & 0x01010101) * 9;   // Nibble values, one per byte
+    w = ((w << 4) | (w >> 8)) & 0x00FF00FF;               // d0:d1 in byte 0, d2:d3 in byte 2
+    dst[0] = uint8_t(w);
+    dst[1] = uint8_t(w >> 16);
+  }
+  if (n) {
+    const uint8_t hi = src[0], lo = src[1];
+    *dst = ((hi & 0x0F) + ((hi >> 6) & 1) * 9) << 4 | ((lo & 0x0F) + ((lo >> 6) & 1) * 9);
+  }
+}
+
 void lv_gcode_file_read(uint8_t *data_buf) {
   #if ENABLED(SDSUPPORT)
-    uint16_t i = 0, j = 0, k = 0;
+    uint16_t i = 0, k = 0;
     uint16_t row_1    = 0;
     bool ignore_start = true;
     char temp_test[200];
@@ -458,11 +480,7 @@ void lv_gcode_file_read(uint8_t *data_buf) {
         card.closefile();
         break;
       }
-      for (i = 0; i < 200;) {
-        public_buf[row_1 * 200 + 100 * k + j] = (char)(ascii2dec_test(&temp_test[i]) << 4 | ascii2dec_test(&temp_test[i + 1]));
-        j++;
-        i += 2;
-      }
+      hex_decode(&public_buf[row_1 * 200 + 100 * k], temp_test, 100);
 
       uint16_t c = card.get();
       // check for more data or end of line (CR or LF)
@@ -473,7 +491,6 @@ void lv_gcode_file_read(uint8_t *data_buf) {
       }
       card.setIndex(card.getIndex() - 1);
       k++;
-      j = 0;
       ignore_start = false;
       if (k > 1) {
         card.closefile();
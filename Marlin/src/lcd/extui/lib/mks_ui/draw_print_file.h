@@ -56,6 +56,7 @@ extern void lv_gcode_file_read(uint8_t *data_buf);
 extern void lv_close_gcode_file();
 extern void cutFileName(char *path, int len, int bytePerLine, char *outStr);
 extern int ascii2dec_test(char *ascii);
+extern void hex_decode(uint8_t *dst, const char *src, const uint16_t bytes);
 extern void lv_clear_print_file();
 extern void lv_gcode_file_seek(uint32_t pos);
 
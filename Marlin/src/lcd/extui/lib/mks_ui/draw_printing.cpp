@@ -47,6 +47,7 @@ static lv_obj_t *scr;
 static lv_obj_t *labelExt1, *labelFan, *labelZpos, *labelTime;
 static lv_obj_t *labelPause, *labelStop, *labelOperat;
 static lv_obj_t *bar1, *bar1ValueText;
+static int bar_rate;
 static lv_obj_t *buttonPause, *buttonOperat, *buttonStop;
 
 #if ENABLED(MIXWARE_MODEL_V)
@@ -130,9 +131,40 @@ static void event_handler(lv_obj_t *obj, lv_event_t event) {
   }
 }
 
+static void disp_printing_values() {
+  disp_ext_temp();
+  disp_bed_temp();
+  disp_fan_speed();
+  disp_print_time();
+  disp_fan_Zpos();
+}
+
 void lv_draw_printing(void) {
   disp_state_stack._disp_index = 0;
   ZERO(disp_state_stack._disp_state);
+
+  #if ENABLED(LVGL_SCREEN_CACHE)
+    if ((scr = lv_screen_reuse(PRINTING_UI))) {
+      const bool working = uiCfg.print_state == WORKING || uiCfg.print_state == REPRINTED;
+      lv_imgbtn_set_src_both(buttonPause, working ? "F:/bmp_pause.bin" : "F:/bmp_resume.bin");
+      if (gCfgItems.multiple_language) {
+        lv_label_set_text(labelPause, working ? printing_menu.pause : printing_menu.resume);
+        lv_obj_align(labelPause, buttonPause, LV_ALIGN_CENTER, 20, 0);
+        #if ENABLED(MIXWARE_MODEL_V)
+          lv_label_set_text(labelDet, gCfgItems.filament_det_enable ? operation_menu.filament_sensor_on : operation_menu.filament_sensor_off);
+          lv_obj_align(labelDet, buttonDet, LV_ALIGN_CENTER, 18, 0);
+        #endif
+      }
+      // Start the bar over, setProBarRate() skips a rate of 0
+      bar_rate = -1;
+      lv_bar_set_value(bar1, 0, LV_ANIM_OFF);
+      lv_label_set_text(bar1ValueText, "0%");
+      lv_obj_align(bar1ValueText, bar1, LV_ALIGN_CENTER, 0, 0);
+      disp_printing_values();
+      return;
+    }
+  #endif
+
   scr = lv_screen_create(PRINTING_UI);
 
   // Create image buttons
@@ -229,15 +261,12 @@ void lv_draw_printing(void) {
   lv_bar_set_style(bar1, LV_BAR_STYLE_INDIC, &lv_bar_style_indic);
   lv_bar_set_anim_time(bar1, 1000);
   lv_bar_set_value(bar1, 0, LV_ANIM_ON);
+  bar_rate = -1;
   bar1ValueText  = lv_label_create_empty(bar1);
   lv_label_set_text(bar1ValueText,"0%");
   lv_obj_align(bar1ValueText, bar1, LV_ALIGN_CENTER, 0, 0);
 
-  disp_ext_temp();
-  disp_bed_temp();
-  disp_fan_speed();
-  disp_print_time();
-  disp_fan_Zpos();
+  disp_printing_values();
 }
 
 void disp_ext_temp() {
@@ -314,9 +343,10 @@ void setProBarRate() {
     lv_obj_align(labelPause, buttonPause, LV_ALIGN_CENTER, 20, 0);
   }
 
-  if (rate <= 0) return;
+  if (rate <= 0 || rate == bar_rate) return;
 
   if (disp_state == PRINTING_UI) {
+    bar_rate = rate;
     lv_bar_set_value(bar1, rate, LV_ANIM_ON);
     sprintf_P(public_buf_l, "%d%%", rate);
     lv_label_set_text(bar1ValueText,public_buf_l);
@@ -328,6 +358,7 @@ void lv_clear_printing() {
   #if HAS_ROTARY_ENCODER
     if (gCfgItems.encoder_enable) lv_group_remove_all_objs(g);
   #endif
+  if (TERN0(LVGL_SCREEN_CACHE, lv_screen_keep(scr, PRINTING_UI))) return;
   lv_obj_del(scr);
 }
 
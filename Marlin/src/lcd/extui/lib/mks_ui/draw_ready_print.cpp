@@ -141,6 +141,19 @@ void lv_draw_ready_print(void) {
 
   disp_state_stack._disp_index = 0;
   ZERO(disp_state_stack._disp_state);
+
+  #if ENABLED(LVGL_SCREEN_CACHE)
+    if ((scr = lv_screen_reuse(PRINT_READY_UI, 0, ""))) {
+      if (mks_test_flag == 0x1E)
+        mks_disp_test();
+      #if ENABLED(MIXWARE_MODEL_V)
+        else
+          disp_ready_print_temp();
+      #endif
+      return;
+    }
+  #endif
+
   scr = lv_screen_create(PRINT_READY_UI, "");
 
   if (mks_test_flag == 0x1E) {
@@ -269,6 +282,7 @@ void lv_clear_ready_print() {
   #if HAS_ROTARY_ENCODER
     if (gCfgItems.encoder_enable) lv_group_remove_all_objs(g);
   #endif
+  if (TERN0(LVGL_SCREEN_CACHE, lv_screen_keep(scr, PRINT_READY_UI))) return;
   lv_obj_del(scr);
 }
 
@@ -38,12 +38,17 @@
 #include "../../../../sd/cardreader.h"
 #include "../../../../module/motion.h"
 #include "../../../../module/planner.h"
+#include "../../../../module/temperature.h"
 #include "../../../../inc/MarlinConfig.h"
 
 #if ENABLED(POWER_LOSS_RECOVERY)
   #include "../../../../feature/powerloss.h"
 #endif
 
+#if HAS_BED_PROBE
+  #include "../../../../module/probe.h"
+#endif
+
 #if ENABLED(PARK_HEAD_ON_PAUSE)
   #include "../../../../feature/pause.h"
 #endif
@@ -52,6 +57,10 @@
   #include "draw_touch_calibration.h"
 #endif
 
+#if ENABLED(LVGL_THUMB_CACHE)
+  #include "thumb_cache.h"
+#endif
+
 CFG_ITMES gCfgItems;
 UI_CFG uiCfg;
 DISP_STATE_STACK disp_state_stack;
@@ -72,7 +81,6 @@ extern bool once_flag;
 extern uint8_t sel_id;
 extern lv_group_t *g;
 
-extern uint8_t bmp_public_buf[14 * 1024];
 extern uint8_t public_buf[513];
 
 extern void LCD_IO_WriteData(uint16_t RegValue);
@@ -670,6 +678,12 @@ char *creat_title_text() {
 
   uint32_t gPicturePreviewStart = 0;
 
+  #if ENABLED(LVGL_THUMB_CACHE)
+    static int8_t preview_slot = -1;  // Cache slot of the file being previewed
+    static bool preview_cached;       // Its large thumbnail is already decoded
+    static uint16_t preview_rows;     // Rows decoded into the slot, in order from the top
+  #endif
+
   void preview_gcode_prehandle(char *path) {
     #if ENABLED(SDSUPPORT)
       uint32_t pre_read_cnt = 0;
@@ -679,12 +693,23 @@ char *creat_title_text() {
       gPicturePreviewStart = 0;
       //cur_name             = strrchr(path, '/');
       card.openFileRead(path);
-      card.read(public_buf, 512);
+      const int16_t br = card.read(public_buf, 512);
+      public_buf[br > 0 ? br : 0] = '\0';
       p1 = (uint32_t *)strstr((char *)public_buf, ";simage:");
 
       if (p1) {
         pre_read_cnt = (uint32_t)p1 - (uint32_t)((uint32_t *)(&public_buf[0]));
 
+        // All 100 rows of ";simage:" are as long as the first, so ";gimage:" follows at a known offset
+        const char * const eol = strpbrk((char *)p1, "\r\n");
+        if (eol && eol[1] != '\0') {
+          const uint32_t gimage = pre_read_cnt + 100 * uint32_t(eol - (char *)p1 + (eol[0] == '\r' && eol[1] == '\n' ? 2 : 1));
+          char tag[8];
+          card.setIndex(gimage);
+          if (card.read(tag, sizeof(tag)) == sizeof(tag) && !memcmp(tag, ";gimage:", sizeof(tag)))
+            gPicturePreviewStart = gimage;
+        }
+
         To_pre_view              = pre_read_cnt;
         gcode_preview_over       = true;
         gCfgItems.from_flash_pic = true;
@@ -697,6 +722,12 @@ char *creat_title_text() {
         update_spi_flash();
       }
       card.closefile();
+
+      #if ENABLED(LVGL_THUMB_CACHE)
+        preview_slot = gcode_preview_over ? thumb_cache.find(path) : -1;
+        preview_cached = preview_slot >= 0 && thumb_cache.has(preview_slot, THUMB_LARGE);
+        preview_rows = 0;
+      #endif
     #endif
   }
 
@@ -706,41 +737,62 @@ char *creat_title_text() {
       volatile uint16_t *p_index;
       //char *cur_name;
 
-      //cur_name = strrchr(path, '/');
-      card.openFileRead(path);
-
-      if (gPicturePreviewStart <= 0) {
-        while (1) {
-          uint32_t br  = card.read(public_buf, 400);
-          uint32_t* p1 = (uint32_t *)strstr((char *)public_buf, ";gimage:");
-          if (p1) {
-            gPicturePreviewStart += (uint32_t)p1 - (uint32_t)((uint32_t *)(&public_buf[0]));
-            break;
-          }
-          else {
-            gPicturePreviewStart += br;
+      #if ENABLED(LVGL_THUMB_CACHE)
+        if (preview_cached) {
+          SPI_TFT.setWindow(xpos_pixel, ypos_pixel + row, 200, 1);
+          W25QXX.init(SPI_QUARTER_SPEED);
+          thumb_cache.read(preview_slot, THUMB_LARGE, uint32_t(row) * 400, bmp_public_buf, 400);
+        }
+        else
+      #endif
+      {
+        //cur_name = strrchr(path, '/');
+        card.openFileRead(path);
+
+        if (gPicturePreviewStart <= 0) {
+          while (1) {
+            uint32_t br  = card.read(public_buf, 400);
+            uint32_t* p1 = (uint32_t *)strstr((char *)public_buf, ";gimage:");
+            if (p1) {
+              gPicturePreviewStart += (uint32_t)p1 - (uint32_t)((uint32_t *)(&public_buf[0]));
+              break;
+            }
+            else {
+              gPicturePreviewStart += br;
+            }
+            if (br < 400) break;
           }
-          if (br < 400) break;
         }
-      }
 
-      card.setIndex(gPicturePreviewStart + size * row + 8);
-      SPI_TFT.setWindow(xpos_pixel, ypos_pixel + row, 200, 1);
+        #if ENABLED(LVGL_THUMB_CACHE)
+          // Only give the file a slot if it really has a preview
+          bool claim = false;
+          if (preview_slot < 0 && row == 0 && gcode_preview_over) {
+            char tag[8];
+            card.setIndex(gPicturePreviewStart);
+            claim = card.read(tag, sizeof(tag)) == sizeof(tag) && !memcmp(tag, ";gimage:", sizeof(tag));
+          }
+        #endif
 
-      j = i = 0;
+        card.setIndex(gPicturePreviewStart + size * row + 8);
+        SPI_TFT.setWindow(xpos_pixel, ypos_pixel + row, 200, 1);
 
-      while (1) {
-        card.read(public_buf, 400);
-        for (i = 0; i < 400;) {
-          bmp_public_buf[j] = ascii2dec_test((char*)&public_buf[i]) << 4 | ascii2dec_test((char*)&public_buf[i + 1]);
-          i                += 2;
-          j++;
+        for (j = 0; j < 400; j += 200) {
+          card.read(public_buf, 400);
+          hex_decode(&bmp_public_buf[j], (char*)public_buf, 200);
         }
-        if (j >= 400) break;
-      }
-      for (i = 0; i < 400; i += 2) {
-        p_index  = (uint16_t *)(&bmp_public_buf[i]);
-        if (*p_index == 0x0000) *p_index = LV_COLOR_BACKGROUND.full;
+        for (i = 0; i < 400; i += 2) {
+          p_index  = (uint16_t *)(&bmp_public_buf[i]);
+          if (*p_index == 0x0000) *p_index = LV_COLOR_BACKGROUND.full;
+        }
+        #if ENABLED(LVGL_THUMB_CACHE)
+          if (claim) preview_slot = thumb_cache.claim(path);
+          if (preview_slot >= 0 && row == preview_rows) {
+            W25QXX.init(SPI_QUARTER_SPEED);
+            thumb_cache.write(preview_slot, THUMB_LARGE, uint32_t(row) * 400, bmp_public_buf, 400);
+            preview_rows++;
+          }
+        #endif
       }
       SPI_TFT.tftio.WriteSequence((uint16_t*)bmp_public_buf, 200);
       #if HAS_BAK_VIEW_IN_FLASH
@@ -750,6 +802,9 @@ char *creat_title_text() {
       #endif
       row++;
       if (row >= 200) {
+        #if ENABLED(LVGL_THUMB_CACHE)
+          if (preview_slot >= 0 && !preview_cached && preview_rows == 200) thumb_cache.finish(preview_slot, THUMB_LARGE);
+        #endif
         size = 809;
         row  = 0;
 
@@ -793,25 +848,17 @@ char *creat_title_text() {
   }
 
   void draw_default_preview(int xpos_pixel, int ypos_pixel, uint8_t sel) {
-    int index;
-    int y_off = 0;
-    W25QXX.init(SPI_QUARTER_SPEED);
-    for (index = 0; index < 10; index++) { // 200*200
+    lv_flush_wait();
+    for (uint8_t y_off = 0; y_off < 10; y_off++) { // 200*200
+      SPI_TFT.setWindow(xpos_pixel, y_off * 20 + ypos_pixel, TERN(MIXWARE_MODEL_V, 160, 200), 20); // 200*200
       #if HAS_BAK_VIEW_IN_FLASH
-        if (sel == 1) {
-          flash_view_Read(bmp_public_buf, 8000); // 20k
-        }
-        else {
-          default_view_Read(bmp_public_buf, DEFAULT_VIEW_MAX_SIZE / 10); // 8k
-        }
+        if (sel == 1)
+          flash_view_Stream(8000, DEFAULT_VIEW_MAX_SIZE / 10); // 20k
+        else
+          default_view_Stream(DEFAULT_VIEW_MAX_SIZE / 10); // 8k
       #else
-        default_view_Read(bmp_public_buf, DEFAULT_VIEW_MAX_SIZE / 10); // 8k
+        default_view_Stream(DEFAULT_VIEW_MAX_SIZE / 10); // 8k
       #endif
-
-      SPI_TFT.setWindow(xpos_pixel, y_off * 20 + ypos_pixel, TERN(MIXWARE_MODEL_V, 160, 200), 20); // 200*200
-      SPI_TFT.tftio.WriteSequence((uint16_t*)(bmp_public_buf), DEFAULT_VIEW_MAX_SIZE / 20);
-
-      y_off++;
     }
     W25QXX.init(SPI_QUARTER_SPEED);
   }
@@ -850,15 +897,84 @@ void print_time_run() {
   }
 }
 
+#define UI_REFRESH_MS       1000
+#define UI_REFRESH_FAST_MS   250  // Screens following manual moves
+#define UI_PROGRESS_MS      1200
+
+enum UIDirtyBit : uint8_t {
+  UI_DIRTY_HOTEND  = _BV(0),
+  UI_DIRTY_BED     = _BV(1),
+  UI_DIRTY_FAN     = _BV(2),
+  UI_DIRTY_POS     = _BV(3),
+  UI_DIRTY_ZOFFSET = _BV(4),
+  UI_DIRTY_ALL     = 0xFF
+};
+
+static uint8_t ui_dirty;
+
+/**
+ * Sample the values shown on the status screens, rounded the way they are
+ * displayed, and flag the ones that changed since the last sample.
+ * A new screen draws everything once, so all flags are raised with it.
+ */
+static void ui_watch_update() {
+  static struct {
+    int16_t hotend[HOTENDS][2], bed[2];
+    uint8_t fan;
+    int32_t pos[XYZ], zoffset;
+  } last;
+  static DISP_STATE last_state = PRINT_READY_UI;
+
+  #define UI_WATCH(V, NOW, BIT) do{ const auto now = (NOW); if ((V) != now) { (V) = now; ui_dirty |= (BIT); } }while(0)
+
+  HOTEND_LOOP() {
+    UI_WATCH(last.hotend[e][0], int16_t(thermalManager.temp_hotend[e].celsius), UI_DIRTY_HOTEND);
+    UI_WATCH(last.hotend[e][1], int16_t(thermalManager.temp_hotend[e].target), UI_DIRTY_HOTEND);
+  }
+  #if HAS_HEATED_BED
+    UI_WATCH(last.bed[0], int16_t(thermalManager.temp_bed.celsius), UI_DIRTY_BED);
+    UI_WATCH(last.bed[1], int16_t(thermalManager.temp_bed.target), UI_DIRTY_BED);
+  #endif
+  #if HAS_FAN
+    UI_WATCH(last.fan, thermalManager.fan_speed[0], UI_DIRTY_FAN);
+  #endif
+  LOOP_XYZ(i) UI_WATCH(last.pos[i], int32_t(LROUND(current_position[i] * 1000)), UI_DIRTY_POS);
+  #if HAS_BED_PROBE
+    UI_WATCH(last.zoffset, int32_t(LROUND(probe.offset.z * 1000)), UI_DIRTY_ZOFFSET);
+  #endif
+
+  #undef UI_WATCH
+
+  if (last_state != disp_state) {
+    last_state = disp_state;
+    ui_dirty = UI_DIRTY_ALL;
+  }
+}
+
+// Clear the given flags, returning true if any of them was set
+static bool ui_take_dirty(const uint8_t bits) {
+  const bool dirty = ui_dirty & bits;
+  ui_dirty &= ~bits;
+  return dirty;
+}
+
 void GUI_RefreshPage() {
-  if ((systick_uptime_millis % 1000) == 0) temps_update_flag = true;
-  if ((systick_uptime_millis % 1200) == 0) printing_rate_update_flag = true;
-  #if ENABLED(MIXWARE_MODEL_V)
-    if ((systick_uptime_millis % 1000) == 0) {
+  static millis_t next_refresh_ms = 0, next_progress_ms = 0;
+  const millis_t ms = millis();
+
+  if (ELAPSED(ms, next_refresh_ms)) {
+    next_refresh_ms = ms + (disp_state == MOVE_MOTOR_UI || disp_state == BABY_STEP_UI ? UI_REFRESH_FAST_MS : UI_REFRESH_MS);
+    temps_update_flag = true;
+    ui_watch_update();
+    #if ENABLED(MIXWARE_MODEL_V)
       level_update_flag = true;
       axis_z_test_start_flag = true;
-    }
-  #endif
+    #endif
+  }
+  if (ELAPSED(ms, next_progress_ms)) {
+    next_progress_ms = ms + UI_PROGRESS_MS;
+    printing_rate_update_flag = true;
+  }
 
   switch (disp_state) {
     case MAIN_UI:
@@ -866,20 +982,20 @@ void GUI_RefreshPage() {
     case EXTRUSION_UI:
       if (temps_update_flag) {
         temps_update_flag = false;
-        disp_hotend_temp();
+        if (ui_take_dirty(UI_DIRTY_HOTEND)) disp_hotend_temp();
       }
       break;
     case PRE_HEAT_UI:
       if (temps_update_flag) {
         temps_update_flag = false;
-        disp_desire_temp();
+        if (ui_take_dirty(UI_DIRTY_HOTEND | UI_DIRTY_BED)) disp_desire_temp();
       }
       break;
     case PRINT_READY_UI:
       #if ENABLED(MIXWARE_MODEL_V)
         if (temps_update_flag) {
           temps_update_flag = false;
-          disp_ready_print_temp();
+          if (ui_take_dirty(UI_DIRTY_HOTEND | UI_DIRTY_BED)) disp_ready_print_temp();
         }
       #endif
       break;
@@ -889,11 +1005,11 @@ void GUI_RefreshPage() {
     case PRINTING_UI:
       if (temps_update_flag) {
         temps_update_flag = false;
-        disp_ext_temp();
-        disp_bed_temp();
-        disp_fan_speed();
-        disp_print_time();
-        disp_fan_Zpos();
+        // The print time follows its own clock in print_time_run()
+        if (ui_take_dirty(UI_DIRTY_HOTEND)) disp_ext_temp();
+        if (ui_take_dirty(UI_DIRTY_BED)) disp_bed_temp();
+        if (ui_take_dirty(UI_DIRTY_FAN)) disp_fan_speed();
+        if (ui_take_dirty(UI_DIRTY_POS)) disp_fan_Zpos();
       }
       if (printing_rate_update_flag || marlin_state == MF_SD_COMPLETE) {
         printing_rate_update_flag = false;
@@ -910,7 +1026,7 @@ void GUI_RefreshPage() {
     case FAN_UI:
       if (temps_update_flag) {
         temps_update_flag = false;
-        disp_fan_value();
+        if (ui_take_dirty(UI_DIRTY_FAN)) disp_fan_value();
       }
       break;
 
@@ -918,7 +1034,7 @@ void GUI_RefreshPage() {
       #if ENABLED(MIXWARE_MODEL_V)
         if (temps_update_flag) {
           temps_update_flag = false;
-          disp_cur_pos();
+          if (ui_take_dirty(UI_DIRTY_POS)) disp_cur_pos();
         }
       #endif
       break;
@@ -938,7 +1054,7 @@ void GUI_RefreshPage() {
     case FILAMENTCHANGE_UI:
       if (temps_update_flag) {
         temps_update_flag = false;
-        disp_filament_temp();
+        if (ui_take_dirty(UI_DIRTY_HOTEND)) disp_filament_temp();
       }
       break;
     case DIALOG_UI:
@@ -1015,7 +1131,7 @@ void GUI_RefreshPage() {
     case BABY_STEP_UI:
       if (temps_update_flag) {
         temps_update_flag = false;
-        disp_z_offset_value();
+        if (ui_take_dirty(UI_DIRTY_ZOFFSET)) disp_z_offset_value();
       }
       break;
     case DEBUG_SELFC_UI:
@@ -1283,12 +1399,8 @@ void lv_btn_set_style_both(lv_obj_t *btn, lv_style_t *style) {
   lv_btn_set_style(btn, LV_BTN_STYLE_PR,  style);
 }
 
-// Create a screen
-lv_obj_t* lv_screen_create(DISP_STATE newScreenType, const char* title) {
-  lv_obj_t *scr = lv_obj_create(nullptr, nullptr);
-  lv_obj_set_style(scr, &tft_style_scr);
-  lv_scr_load(scr);
-  lv_obj_clean(scr);
+static void lv_screen_enter(DISP_STATE newScreenType) {
+  TERN_(LVGL_SCREEN_CACHE, lv_heap_sample());
 
   // breadcrumbs
   if (disp_state_stack._disp_state[disp_state_stack._disp_index] != newScreenType) {
@@ -1296,6 +1408,16 @@ lv_obj_t* lv_screen_create(DISP_STATE newScreenType, const char* title) {
     disp_state_stack._disp_state[disp_state_stack._disp_index] = newScreenType;
   }
   disp_state = newScreenType;
+}
+
+// Create a screen
+lv_obj_t* lv_screen_create(DISP_STATE newScreenType, const char* title) {
+  lv_obj_t *scr = lv_obj_create(nullptr, nullptr);
+  lv_obj_set_style(scr, &tft_style_scr);
+  lv_scr_load(scr);
+  lv_obj_clean(scr);
+
+  lv_screen_enter(newScreenType);
 
   // title
   lv_obj_t *titleLabel = nullptr;
@@ -1316,6 +1438,98 @@ lv_obj_t* lv_screen_create(DISP_STATE newScreenType, const char* title) {
   return scr;
 }
 
+#if ENABLED(LVGL_SCREEN_CACHE)
+
+  /**
+   * Screen cache: the busiest screens are kept built when left, and shown
+   * again as they are on return. A screen whose layout depends on state
+   * passes that as its variant. Anything changing every screen's layout
+   * (language, temperature mode...) is in the signature and drops them all.
+   */
+  static struct {
+    DISP_STATE type;
+    uint8_t variant;
+    lv_obj_t *scr;
+  } screen_cache[] = { { PRINT_READY_UI }, { PRINTING_UI }, { MOVE_MOTOR_UI }, { EXTRUSION_UI } };
+
+  static uint32_t screen_cache_sig, screen_cache_hits, screen_cache_misses, lv_heap_peak;
+
+  static uint32_t screen_cache_signature() {
+    return uint32_t(gCfgItems.language)
+         | uint32_t(gCfgItems.multiple_language) << 8
+         | uint32_t(gCfgItems.filament_max_temper > 300) << 9
+         | uint32_t(gCfgItems.disp_rotation_180 != 0) << 10
+         | uint32_t(TERN0(HAS_ROTARY_ENCODER, gCfgItems.encoder_enable)) << 11
+         | uint32_t(mks_test_flag) << 16;
+  }
+
+  // Only called on the way to another screen, so the one being left can go too
+  void lv_screen_cache_flush() {
+    for (auto &c : screen_cache)
+      if (c.scr) { lv_obj_del(c.scr); c.scr = nullptr; }
+  }
+
+  // The cached screen of this type and variant, made current. Otherwise nullptr and a slot is readied for it.
+  lv_obj_t* lv_screen_reuse(DISP_STATE newScreenType, uint8_t variant/*=0*/, const char* title/*=nullptr*/) {
+    const uint32_t sig = screen_cache_signature();
+    if (sig != screen_cache_sig) {
+      screen_cache_sig = sig;
+      lv_screen_cache_flush();
+    }
+    // The encoder group would need to be rebuilt, so don't bother
+    if (TERN0(HAS_ROTARY_ENCODER, gCfgItems.encoder_enable)) return nullptr;
+
+    for (auto &c : screen_cache) {
+      if (c.type != newScreenType) continue;
+      if (c.scr && c.variant == variant) {
+        screen_cache_hits++;
+        lv_scr_load(c.scr);
+        lv_screen_enter(newScreenType);
+        if (!title) lv_label_set_text(lv_obj_get_child_back(c.scr, nullptr), creat_title_text());
+        lv_refr_now(lv_refr_get_disp_refreshing());
+        return c.scr;
+      }
+      if (c.scr) lv_obj_del(c.scr);
+      c.scr = nullptr;
+      c.variant = variant;
+      break;
+    }
+    screen_cache_misses++;
+    return nullptr;
+  }
+
+  // Hold on to a screen being left, if there is a slot for it. False if the caller should delete it.
+  bool lv_screen_keep(lv_obj_t *scr, DISP_STATE screenType) {
+    if (TERN0(HAS_ROTARY_ENCODER, gCfgItems.encoder_enable)) return false;
+    for (auto &c : screen_cache)
+      if (c.type == screenType) {
+        if (c.scr && c.scr != scr) lv_obj_del(c.scr);
+        c.scr = scr;
+        return true;
+      }
+    return false;
+  }
+
+  // LVGL keeps no high-water mark of its own, so sample on every screen change
+  void lv_heap_sample() {
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    NOLESS(lv_heap_peak, mon.total_size - mon.free_size);
+  }
+
+  void lv_heap_report() {
+    lv_mem_monitor_t mon;
+    lv_heap_sample();
+    lv_mem_monitor(&mon);
+    SERIAL_ECHOLNPAIR("LVGL heap:", mon.total_size, " used:", mon.total_size - mon.free_size, " peak:", lv_heap_peak,
+                      " biggest free:", mon.free_biggest_size, " frag:", mon.frag_pct, "%");
+    uint8_t cached = 0;
+    for (auto &c : screen_cache) if (c.scr) cached++;
+    SERIAL_ECHOLNPAIR("Screen cache:", cached, "/", COUNT(screen_cache), " hits:", screen_cache_hits, " misses:", screen_cache_misses);
+  }
+
+#endif // LVGL_SCREEN_CACHE
+
 // Create an empty label
 lv_obj_t* lv_label_create_empty(lv_obj_t *par) {
   lv_obj_t *label = lv_label_create(par, (lv_obj_t*)nullptr);
@@ -1605,6 +1819,7 @@ void lv_print_finished() {
 }
 
 void LV_TASK_HANDLER() {
+  if (TERN0(LVGL_DEFERRED_INIT, !lv_deferred_init())) return;
   lv_task_handler();
   if (mks_test_flag == 0x1E) mks_hardware_test();
 
@@ -605,6 +605,19 @@ void lv_btn_set_style_both(lv_obj_t *btn, lv_style_t *style);
 // Create a screen
 lv_obj_t* lv_screen_create(DISP_STATE newScreenType, const char* title = nullptr);
 
+#if ENABLED(LVGL_SCREEN_CACHE)
+  // Show a cached screen again, or nullptr if it has to be built
+  lv_obj_t* lv_screen_reuse(DISP_STATE newScreenType, uint8_t variant=0, const char* title=nullptr);
+  // Keep the screen being left for later. False if it should be deleted.
+  bool lv_screen_keep(lv_obj_t *scr, DISP_STATE screenType);
+  void lv_screen_cache_flush();
+  void lv_heap_sample();
+  void lv_heap_report();
+#endif
+TERN_(LVGL_GLYPH_CACHE, void lv_glyph_cache_report());
+// Finish the init left for after setup(). True once the UI can run.
+TERN_(LVGL_DEFERRED_INIT, bool lv_deferred_init());
+
 // Create an empty label
 lv_obj_t* lv_label_create_empty(lv_obj_t *par);
 
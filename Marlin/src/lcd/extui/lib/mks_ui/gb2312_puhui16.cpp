@@ -34,13 +34,21 @@ typedef struct {
   uint16_t min;
   uint16_t max;
   uint8_t bpp;
-  uint8_t reserved[3];
+  uint8_t format;   // XBF_PACKED for a font made by lvgl_font_subset.py
+  uint16_t count;   // Glyphs of a packed font
 } x_header_t;
 
 typedef struct {
   uint32_t pos;
 } x_table_t;
 
+// A packed font lists only the glyphs it has, sorted, instead of a table from min to max
+#define XBF_PACKED 'P'
+typedef struct __attribute__((packed)) {
+  uint16_t unicode;
+  uint32_t pos;
+} x_entry_t;
+
 typedef struct {
   uint8_t adv_w;
   uint8_t box_w;
@@ -54,45 +62,99 @@ static uint8_t *__user_font_getdata(int offset, int size) {
   return __g_font_buf;
 }
 
-static const uint8_t * __user_font_get_bitmap(const lv_font_t * font, uint32_t unicode_letter) {
-  if (__g_xbf_hd.max == 0) {
-    uint8_t *p = __user_font_getdata(0, sizeof(x_header_t));
-    memcpy(&__g_xbf_hd, p, sizeof(x_header_t));
+/**
+ * LVGL asks for the descriptor and then the bitmap of every glyph it
+ * draws, each costing a few SPI Flash reads. Both are fetched together
+ * into a small LRU cache, so redrawing a label (digits of a temperature,
+ * progress...) is served from RAM. Without LVGL_GLYPH_CACHE a single
+ * entry still saves the second lookup of each glyph.
+ */
+typedef struct {
+  uint32_t stamp;         // Last use; 0 = empty
+  uint16_t unicode;
+  bool found;
+  struct {
+    glyph_dsc_t dsc;
+    uint8_t bitmap[sizeof(__g_font_buf)];
+  } glyph;                // As stored in the font
+} glyph_cache_t;
+
+static glyph_cache_t glyph_cache[TERN(LVGL_GLYPH_CACHE, LVGL_GLYPH_CACHE_SIZE, 1)];
+static uint32_t glyph_cache_tick;
+#if ENABLED(LVGL_GLYPH_CACHE)
+  static uint32_t glyph_cache_hits, glyph_cache_misses;
+#endif
+
+// Where the glyph is in the font, or 0 if it isn't
+static uint32_t __user_font_get_pos(uint32_t unicode_letter) {
+  if (__g_xbf_hd.format == XBF_PACKED) {
+    uint16_t lo = 0, hi = __g_xbf_hd.count;
+    while (lo < hi) {
+      const uint16_t mid = (lo + hi) / 2;
+      x_entry_t e;
+      get_spi_flash_data((char *)&e, sizeof(x_header_t) + mid * sizeof(x_entry_t), sizeof(x_entry_t));
+      if (e.unicode == unicode_letter) return e.pos;
+      if (e.unicode < unicode_letter) lo = mid + 1; else hi = mid;
+    }
+    return 0;
   }
-  if (unicode_letter > __g_xbf_hd.max || unicode_letter < __g_xbf_hd.min)
-    return nullptr;
   uint32_t unicode_offset = sizeof(x_header_t) + (unicode_letter - __g_xbf_hd.min) * 4;
   uint32_t *p_pos = (uint32_t *)__user_font_getdata(unicode_offset, 4);
-  if (p_pos[0] != 0) {
-    uint32_t pos = p_pos[0];
-    __user_font_getdata(pos, 2);
-    return __user_font_getdata(pos + 2, sizeof(__g_font_buf));
-  }
-  return nullptr;
+  return p_pos[0];
 }
 
-static bool __user_font_get_glyph_dsc(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter, uint32_t unicode_letter_next) {
+static const glyph_cache_t* __user_font_get_glyph(uint32_t unicode_letter) {
   if (__g_xbf_hd.max == 0) {
     uint8_t *p = __user_font_getdata(0, sizeof(x_header_t));
     memcpy(&__g_xbf_hd, p, sizeof(x_header_t));
   }
   if (unicode_letter > __g_xbf_hd.max || unicode_letter < __g_xbf_hd.min)
-    return false;
-  uint32_t unicode_offset = sizeof(x_header_t) + (unicode_letter - __g_xbf_hd.min) * 4;
-  uint32_t *p_pos = (uint32_t *)__user_font_getdata(unicode_offset, 4);
-  if (p_pos[0] != 0) {
-    glyph_dsc_t * gdsc = (glyph_dsc_t*)__user_font_getdata(p_pos[0], 2);
-    dsc_out->adv_w = gdsc->adv_w;
-    dsc_out->box_h = font->line_height;
-    dsc_out->box_w = gdsc->box_w;
-    dsc_out->ofs_x = 0;
-    dsc_out->ofs_y = 0;
-    dsc_out->bpp = __g_xbf_hd.bpp;
-    return true;
+    return nullptr;
+
+  glyph_cache_t *g = &glyph_cache[0];
+  for (auto &c : glyph_cache) {
+    if (c.stamp && c.unicode == unicode_letter) {
+      TERN_(LVGL_GLYPH_CACHE, glyph_cache_hits++);
+      c.stamp = ++glyph_cache_tick;
+      return &c;
+    }
+    if (c.stamp < g->stamp) g = &c;   // Least recently used
   }
-  return false;
+
+  TERN_(LVGL_GLYPH_CACHE, glyph_cache_misses++);
+  g->stamp = ++glyph_cache_tick;
+  g->unicode = unicode_letter;
+  const uint32_t pos = __user_font_get_pos(unicode_letter);
+  g->found = pos != 0;
+  if (g->found) get_spi_flash_data((char *)&g->glyph, pos, sizeof(g->glyph));
+  return g;
+}
+
+static const uint8_t * __user_font_get_bitmap(const lv_font_t * font, uint32_t unicode_letter) {
+  const glyph_cache_t *g = __user_font_get_glyph(unicode_letter);
+  return (g && g->found) ? g->glyph.bitmap : nullptr;
 }
 
+static bool __user_font_get_glyph_dsc(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter, uint32_t unicode_letter_next) {
+  const glyph_cache_t *g = __user_font_get_glyph(unicode_letter);
+  if (!g || !g->found) return false;
+  dsc_out->adv_w = g->glyph.dsc.adv_w;
+  dsc_out->box_h = font->line_height;
+  dsc_out->box_w = g->glyph.dsc.box_w;
+  dsc_out->ofs_x = 0;
+  dsc_out->ofs_y = 0;
+  dsc_out->bpp = __g_xbf_hd.bpp;
+  return true;
+}
+
+#if ENABLED(LVGL_GLYPH_CACHE)
+  void lv_glyph_cache_report() {
+    uint8_t used = 0;
+    for (auto &c : glyph_cache) if (c.stamp) used++;
+    SERIAL_ECHOLNPAIR("Glyph cache:", used, "/", COUNT(glyph_cache), " hits:", glyph_cache_hits, " misses:", glyph_cache_misses);
+  }
+#endif
+
 lv_font_t gb2312_puhui32;
 void init_gb2312_font() {
   gb2312_puhui32.get_glyph_bitmap = __user_font_get_bitmap;
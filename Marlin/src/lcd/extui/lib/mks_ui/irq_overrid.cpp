@@ -52,6 +52,11 @@
       WRITE(WIFI_IO1_PIN, HIGH);
 
     WIFISERIAL.wifi_usart_irq(USART1_BASE);
+
+    #if ENABLED(MKS_WIFI_DMA_RX)
+      if ((USART1_BASE->CR1 & USART_CR1_IDLEIE) && (USART1_BASE->SR & (USART_SR_IDLE | USART_SR_ORE)))
+        wifi_rx_idle_irq();
+    #endif
   }
 
   #ifdef __cplusplus
@@ -28,9 +28,11 @@
 #include "pic_manager.h"
 #include "draw_ready_print.h"
 #include "mks_hardware_test.h"
+#include "SPI_TFT.h"
 
 #include "SPIFlashStorage.h"
 #include "../../../../libs/W25Qxx.h"
+#include "../../../../libs/crc16.h"
 
 #include "../../../../sd/cardreader.h"
 #include "../../../../MarlinCore.h"
@@ -370,18 +372,19 @@ static const char assets[][LONG_FILENAME_LENGTH] = {
 
 uint8_t currentFlashPage = 0;
 
-uint32_t lv_get_pic_addr(uint8_t *Pname) {
+static uint32_t pic_slot_addr(const uint8_t i) {
+  if ((DeviceCode == 0x9488) || (DeviceCode == 0x5761))
+    return PIC_DATA_ADDR_TFT35 + i * PER_PIC_MAX_SPACE_TFT35;
+  else
+    return PIC_DATA_ADDR_TFT32 + i * PER_PIC_MAX_SPACE_TFT32;
+}
+
+// Index of a picture in the name table, or -1
+static int16_t pic_find(const uint8_t *Pname) {
   uint8_t Pic_cnt;
   uint8_t i, j;
   PIC_MSG PIC;
   uint32_t tmp_cnt = 0;
-  uint32_t addr = 0;
-
-  currentFlashPage = 0;
-
-  #if ENABLED(MARLIN_DEV_MODE)
-    SERIAL_ECHOLNPAIR("Getting picture SPI Flash Address: ", (const char*)Pname);
-  #endif
 
   W25QXX.init(SPI_QUARTER_SPEED);
 
@@ -394,16 +397,21 @@ uint32_t lv_get_pic_addr(uint8_t *Pname) {
       tmp_cnt++;
     } while (PIC.name[j++] != '\0');
 
-    if ((strcasecmp((char*)Pname, (char*)PIC.name)) == 0) {
-      if ((DeviceCode == 0x9488) || (DeviceCode == 0x5761))
-        addr = PIC_DATA_ADDR_TFT35 + i * PER_PIC_MAX_SPACE_TFT35;
-      else
-        addr = PIC_DATA_ADDR_TFT32 + i * PER_PIC_MAX_SPACE_TFT32;
-      return addr;
-    }
+    if ((strcasecmp((char*)Pname, (char*)PIC.name)) == 0) return i;
   }
 
-  return addr;
+  return -1;
+}
+
+uint32_t lv_get_pic_addr(uint8_t *Pname) {
+  currentFlashPage = 0;
+
+  #if ENABLED(MARLIN_DEV_MODE)
+    SERIAL_ECHOLNPAIR("Getting picture SPI Flash Address: ", (const char*)Pname);
+  #endif
+
+  const int16_t i = pic_find(Pname);
+  return i < 0 ? 0 : pic_slot_addr(i);
 }
 
 const char *assetsPath = "assets";
@@ -435,6 +443,42 @@ void spiFlashErase_PIC() {
   }
 #endif
 
+/**
+ * Erase [addr, addr + size) without losing whatever else shares its
+ * first and last sectors. Whole 64K blocks inside the range go at once.
+ * Only for UpdateAssets, which runs before LVGL owns bmp_public_buf.
+ */
+static void spiFlashErase_Range(const uint32_t addr, const uint32_t size) {
+  constexpr uint32_t block = 64 * 1024;
+  const uint32_t end = addr + size;
+  W25QXX.init(SPI_QUARTER_SPEED);
+  for (uint32_t sector = addr & ~(SPI_FLASH_SectorSize - 1); sector < end;) {
+    watchdog_refresh();
+    if (sector % block == 0 && sector >= addr && sector + block <= end) {
+      W25QXX.SPI_FLASH_BlockErase(sector);
+      sector += block;
+      continue;
+    }
+    const uint16_t head = sector < addr ? addr - sector : 0,
+                   tail = sector + SPI_FLASH_SectorSize > end ? end - sector : SPI_FLASH_SectorSize;
+    if (head || tail < SPI_FLASH_SectorSize)
+      W25QXX.SPI_FLASH_BufferRead(bmp_public_buf, sector, SPI_FLASH_SectorSize);
+    W25QXX.SPI_FLASH_SectorErase(sector);
+    if (head) W25QXX.SPI_FLASH_BufferWrite(bmp_public_buf, sector, head);
+    if (tail < SPI_FLASH_SectorSize) W25QXX.SPI_FLASH_BufferWrite(&bmp_public_buf[tail], sector + tail, SPI_FLASH_SectorSize - tail);
+    sector += SPI_FLASH_SectorSize;
+  }
+}
+
+// Make sure a few bytes are blank before programming them
+static void spiFlashErase_Dirty(const uint32_t addr, const uint16_t size) {
+  uint8_t b;
+  LOOP_L_N(i, size) {
+    W25QXX.SPI_FLASH_BufferRead(&b, addr + i, 1);
+    if (b != 0xFF) return spiFlashErase_Range(addr, size);
+  }
+}
+
 uint32_t LogoWrite_Addroffset = 0;
 
 uint8_t Pic_Logo_Write(uint8_t *LogoName, uint8_t *Logo_Wbuff, uint32_t LogoWriteSize) {
@@ -442,11 +486,8 @@ uint8_t Pic_Logo_Write(uint8_t *LogoName, uint8_t *Logo_Wbuff, uint32_t LogoWrit
 
   W25QXX.SPI_FLASH_BufferWrite(Logo_Wbuff, PIC_LOGO_ADDR + LogoWrite_Addroffset, LogoWriteSize);
 
-  for (uint32_t i = 0; i < LogoWriteSize; i++) {
-    uint8_t temp1;
-    W25QXX.SPI_FLASH_BufferRead(&temp1, PIC_LOGO_ADDR + LogoWrite_Addroffset + i, 1);
-    if (*(Logo_Wbuff + i) != temp1) return 0;
-  }
+  W25QXX.SPI_FLASH_BufferRead(bmp_public_buf, PIC_LOGO_ADDR + LogoWrite_Addroffset, LogoWriteSize);
+  if (memcmp(Logo_Wbuff, bmp_public_buf, LogoWriteSize)) return 0;
   LogoWrite_Addroffset += LogoWriteSize;
   const uint32_t logo_maxsize = DeviceCode == 0x9488 || DeviceCode == 0x5761 ? LOGO_MAX_SIZE_TFT35 : LOGO_MAX_SIZE_TFT32;
   if (LogoWrite_Addroffset >= logo_maxsize) LogoWrite_Addroffset = 0;
@@ -508,9 +549,12 @@ uint32_t Pic_Info_Write(uint8_t *P_name, uint32_t P_size) {
     name_len++;
   }
 
+  // An update cut short may have left a name and size here without counting them
   Pic_NameSaveAddr = PIC_NAME_ADDR + SaveName_len;
+  spiFlashErase_Dirty(Pic_NameSaveAddr, name_len + 1);
   W25QXX.SPI_FLASH_BufferWrite(P_name, Pic_NameSaveAddr, name_len + 1);
   Pic_SizeSaveAddr = PIC_SIZE_ADDR + 4 * pic_counter;
+  spiFlashErase_Dirty(Pic_SizeSaveAddr, 4);
   size_tmp.dwords = P_size;
   W25QXX.SPI_FLASH_BufferWrite(size_tmp.bytes, Pic_SizeSaveAddr, 4);
 
@@ -541,16 +585,123 @@ uint32_t Pic_Info_Write(uint8_t *P_name, uint32_t P_size) {
     return -1;
   }
 
-  #if ENABLED(MARLIN_DEV_MODE)
-    static uint32_t totalSizes = 0, totalCompressed = 0;
-  #endif
-
   #define ASSET_TYPE_ICON       0
   #define ASSET_TYPE_LOGO       1
   #define ASSET_TYPE_TITLE_LOGO 2
   #define ASSET_TYPE_G_PREVIEW  3
   #define ASSET_TYPE_FONT       4
-  static void loadAsset(SdFile &dir, dir_t& entry, const char *fn, int8_t assetType) {
+
+  /**
+   * Asset manifest: an append-only log of { key, size, crc } records in
+   * one sector, the latest record per key winning. The key is a hash of the
+   * asset name, so the records still hold when assets are added or reordered.
+   * A record is added once its asset is fully written, so an interrupted
+   * update resumes with the assets that are still missing and later updates
+   * skip unchanged files.
+   */
+  #define ASSET_KEYS          (COUNT(assets) + TERN0(HAS_SPI_FLASH_FONT, COUNT(fonts)))
+  #define ASSET_MANIFEST_TAG  0x31534D41 // "AMS1"
+  #define ASSET_MANIFEST_MAX  (SPI_FLASH_SectorSize / sizeof(asset_record_t))
+  #define ASSET_UNKNOWN       0xFFFFFFFF
+
+  typedef struct { uint32_t key, size; uint16_t crc, reserved; } asset_record_t;
+
+  #ifdef ASSET_MANIFEST_ADDR
+    #define FLASH_OVERLAP(A,AS,B,BS) ((A) < (B) + (BS) && (B) < (A) + (AS))
+    static_assert(ASSET_MANIFEST_ADDR + SPI_FLASH_SectorSize <= SPI_FLASH_SIZE, "The asset manifest doesn't fit in SPI Flash.");
+    static_assert(!FLASH_OVERLAP(ASSET_MANIFEST_ADDR, SPI_FLASH_SectorSize, PICINFOADDR, PIC_SIZE_xM * 1024UL * 1024UL), "The asset manifest overlaps the pictures.");
+    static_assert(!FLASH_OVERLAP(ASSET_MANIFEST_ADDR, SPI_FLASH_SectorSize, FONTINFOADDR, 31 * 64 * 1024UL), "The asset manifest overlaps the fonts.");
+    static_assert(!FLASH_OVERLAP(ASSET_MANIFEST_ADDR, SPI_FLASH_SectorSize, THUMB_CACHE_ADDR, uint32_t(THUMB_CACHE_SLOTS) * THUMB_SLOT_SIZE), "The asset manifest overlaps the thumbnail cache.");
+    static_assert(!FLASH_OVERLAP(ASSET_MANIFEST_ADDR, SPI_FLASH_SectorSize, REFLSHE_FLGA_ADD, 32), "The asset manifest overlaps the flash flag.");
+    #undef FLASH_OVERLAP
+  #endif
+
+  static uint16_t manifest_used;
+
+  // FNV-1a hash of an asset name
+  static uint32_t asset_key(const char *name) {
+    uint32_t h = 2166136261UL;
+    while (*name) h = (h ^ uint8_t(*name++)) * 16777619UL;
+    return h;
+  }
+
+  // Replay the manifest. False when there is none to go by.
+  static bool manifest_load(asset_record_t state[]) {
+    for (uint16_t k = 0; k < ASSET_KEYS; k++) {
+      const char * const name = k < COUNT(assets) ? assets[k] : TERN(HAS_SPI_FLASH_FONT, fonts[k - COUNT(assets)], "");
+      state[k] = { asset_key(name), ASSET_UNKNOWN, 0xFFFF, 0xFFFF };
+    }
+    manifest_used = 0;
+    #ifdef ASSET_MANIFEST_ADDR
+      asset_record_t rec;
+      W25QXX.init(SPI_QUARTER_SPEED);
+      for (; manifest_used < ASSET_MANIFEST_MAX; manifest_used++) {
+        W25QXX.SPI_FLASH_BufferRead((uint8_t *)&rec, ASSET_MANIFEST_ADDR + manifest_used * sizeof(rec), sizeof(rec));
+        if (rec.key == ASSET_UNKNOWN) break;
+        if (manifest_used == 0 && rec.key != ASSET_MANIFEST_TAG) return false;
+        for (uint16_t k = 0; k < ASSET_KEYS; k++) if (state[k].key == rec.key) { state[k] = rec; break; }
+      }
+    #endif
+    return manifest_used > 0;
+  }
+
+  static void manifest_append(const asset_record_t &rec) {
+    #ifdef ASSET_MANIFEST_ADDR
+      W25QXX.SPI_FLASH_BufferWrite((uint8_t *)&rec, ASSET_MANIFEST_ADDR + manifest_used++ * sizeof(rec), sizeof(rec));
+    #else
+      UNUSED(rec);
+    #endif
+  }
+
+  // Start a new log, carrying over the current state if given
+  static void manifest_reset(const asset_record_t state[]=nullptr) {
+    #ifdef ASSET_MANIFEST_ADDR
+      W25QXX.SPI_FLASH_SectorErase(ASSET_MANIFEST_ADDR);
+      manifest_used = 0;
+      manifest_append({ ASSET_MANIFEST_TAG, 0, 0, 0 });
+      if (state) for (uint16_t k = 0; k < ASSET_KEYS; k++) if (state[k].size != ASSET_UNKNOWN) manifest_append(state[k]);
+    #else
+      UNUSED(state);
+    #endif
+  }
+
+  static uint16_t file_crc(SdFile &file) {
+    uint16_t crc = 0;
+    int16_t pbr;
+    while ((pbr = file.read(public_buf, BMP_WRITE_BUF_LEN)) > 0) {
+      watchdog_refresh();
+      crc16(&crc, public_buf, pbr);
+    }
+    file.rewind();
+    return crc;
+  }
+
+  // Clear the space an asset is about to take when the bulk erase was skipped. Icons see to their own slot.
+  static void eraseAsset(int8_t assetType, uint32_t size) {
+    const bool tft35 = (DeviceCode == 0x9488) || (DeviceCode == 0x5761);
+    switch (assetType) {
+      case ASSET_TYPE_LOGO:
+        spiFlashErase_Range(PIC_LOGO_ADDR, _MIN(size, tft35 ? LOGO_MAX_SIZE_TFT35 : LOGO_MAX_SIZE_TFT32));
+        break;
+      case ASSET_TYPE_TITLE_LOGO:
+        spiFlashErase_Range(tft35 ? PIC_ICON_LOGO_ADDR_TFT35 : PIC_ICON_LOGO_ADDR_TFT32, _MIN(size, TITLELOGO_MAX_SIZE));
+        break;
+      case ASSET_TYPE_G_PREVIEW:
+        spiFlashErase_Range(DEFAULT_VIEW_ADDR_TFT35, _MIN(size, DEFAULT_VIEW_MAX_SIZE));
+        break;
+      #if HAS_SPI_FLASH_FONT
+        case ASSET_TYPE_FONT:
+          spiFlashErase_Range(UNIGBK_FLASH_ADDR, size);
+          break;
+      #endif
+    }
+  }
+
+  #if ENABLED(MARLIN_DEV_MODE)
+    static uint32_t totalSizes = 0, totalCompressed = 0;
+  #endif
+
+  static void loadAsset(SdFile &dir, dir_t& entry, const char *fn, int8_t assetType, asset_record_t &state, const bool erased) {
     SdFile file;
     char dosFilename[FILENAME_LENGTH];
     createFilename(dosFilename, entry);
@@ -562,20 +713,31 @@ uint32_t Pic_Info_Write(uint8_t *P_name, uint32_t P_size) {
     }
 
     watchdog_refresh();
-    disp_assets_update_progress(fn);
 
     W25QXX.init(SPI_QUARTER_SPEED);
 
-    uint16_t pbr;
+    int16_t pbr;
     uint32_t pfileSize;
-    uint32_t totalSizeLoaded = 0;
     uint32_t Pic_Write_Addr;
     pfileSize = file.fileSize();
-    totalSizeLoaded += pfileSize;
+
+    // Only a file of the same size needs reading to be sure it's unchanged
+    if (pfileSize == state.size && file_crc(file) == state.crc) {
+      file.close();
+      return;
+    }
+
+    disp_assets_update_progress(fn);
+    if (!erased) eraseAsset(assetType, pfileSize);
+
+    uint16_t crc = 0;
+    LogoWrite_Addroffset = TitleLogoWrite_Addroffset = default_view_addroffset_r = 0;
+
     if (assetType == ASSET_TYPE_LOGO) {
       do {
         watchdog_refresh();
         pbr = file.read(public_buf, BMP_WRITE_BUF_LEN);
+        if (pbr > 0) crc16(&crc, public_buf, pbr);
         Pic_Logo_Write((uint8_t *)fn, public_buf, pbr);
       } while (pbr >= BMP_WRITE_BUF_LEN);
     }
@@ -583,6 +745,7 @@ uint32_t Pic_Info_Write(uint8_t *P_name, uint32_t P_size) {
       do {
         watchdog_refresh();
         pbr = file.read(public_buf, BMP_WRITE_BUF_LEN);
+        if (pbr > 0) crc16(&crc, public_buf, pbr);
         Pic_TitleLogo_Write((uint8_t *)fn, public_buf, pbr);
       } while (pbr >= BMP_WRITE_BUF_LEN);
     }
@@ -590,22 +753,49 @@ uint32_t Pic_Info_Write(uint8_t *P_name, uint32_t P_size) {
       do {
         watchdog_refresh();
         pbr = file.read(public_buf, BMP_WRITE_BUF_LEN);
+        if (pbr > 0) crc16(&crc, public_buf, pbr);
         default_view_Write(public_buf, pbr);
       } while (pbr >= BMP_WRITE_BUF_LEN);
     }
     else if (assetType == ASSET_TYPE_ICON) {
-      Pic_Write_Addr = Pic_Info_Write((uint8_t *)fn, pfileSize);
+      const int16_t slot = erased ? -1 : pic_find((const uint8_t *)fn);
+      if (slot < 0)
+        Pic_Write_Addr = Pic_Info_Write((uint8_t *)fn, pfileSize);
+      else {
+        // Known picture, keep its slot and refresh its size
+        union union32 size_tmp;
+        size_tmp.dwords = pfileSize;
+        Pic_Write_Addr = pic_slot_addr(slot);
+        spiFlashErase_Range(PIC_SIZE_ADDR + 4 * slot, 4);
+        W25QXX.SPI_FLASH_BufferWrite(size_tmp.bytes, PIC_SIZE_ADDR + 4 * slot, 4);
+      }
+      if (!erased) spiFlashErase_Range(Pic_Write_Addr, pic_slot_addr(1) - pic_slot_addr(0));
       SPIFlash.beginWrite(Pic_Write_Addr);
       #if HAS_SPI_FLASH_COMPRESSION
+        #if ENABLED(LVGL_HEATSHRINK_ASSETS)
+          bool packed = false;
+          uint16_t pages = 0;
+        #endif
         do {
           watchdog_refresh();
           pbr = file.read(public_buf, SPI_FLASH_PageSize);
+          if (pbr > 0) crc16(&crc, public_buf, pbr);
           TERN_(MARLIN_DEV_MODE, totalSizes += pbr);
+          #if ENABLED(LVGL_HEATSHRINK_ASSETS)
+            // Compressed on the host already, so store it as it is
+            if (pages++ == 0) packed = pbr >= 4 && SPIFlash.isHeatshrink(public_buf);
+            if (packed) {
+              if (pbr > 0) W25QXX.SPI_FLASH_BufferWrite(public_buf, Pic_Write_Addr, pbr);
+              Pic_Write_Addr += pbr;
+              continue;
+            }
+          #endif
           SPIFlash.writeData(public_buf, SPI_FLASH_PageSize);
         } while (pbr >= SPI_FLASH_PageSize);
       #else
         do {
           pbr = file.read(public_buf, BMP_WRITE_BUF_LEN);
+          if (pbr > 0) crc16(&crc, public_buf, pbr);
           W25QXX.SPI_FLASH_BufferWrite(public_buf, Pic_Write_Addr, pbr);
           Pic_Write_Addr += pbr;
         } while (pbr >= BMP_WRITE_BUF_LEN);
@@ -621,6 +811,7 @@ uint32_t Pic_Info_Write(uint8_t *P_name, uint32_t P_size) {
       do {
         watchdog_refresh();
         pbr = file.read(public_buf, BMP_WRITE_BUF_LEN);
+        if (pbr > 0) crc16(&crc, public_buf, pbr);
         W25QXX.SPI_FLASH_BufferWrite(public_buf, Pic_Write_Addr, pbr);
         Pic_Write_Addr += pbr;
       } while (pbr >= BMP_WRITE_BUF_LEN);
@@ -628,6 +819,10 @@ uint32_t Pic_Info_Write(uint8_t *P_name, uint32_t P_size) {
 
     file.close();
 
+    state.crc = crc;
+    state.size = pfileSize;
+    manifest_append(state);
+
     #if ENABLED(MARLIN_DEV_MODE)
       SERIAL_ECHOLNPAIR("Asset added: ", fn);
     #endif
@@ -637,16 +832,25 @@ uint32_t Pic_Info_Write(uint8_t *P_name, uint32_t P_size) {
     if (!card.isMounted()) return;
     SdFile dir, root = card.getroot();
     if (dir.open(&root, assetsPath, O_RDONLY)) {
+      asset_record_t state[ASSET_KEYS];
 
       disp_assets_update();
-      disp_assets_update_progress("Erasing pics...");
-      watchdog_refresh();
-      spiFlashErase_PIC();
-      #if HAS_SPI_FLASH_FONT
-        disp_assets_update_progress("Erasing fonts...");
+
+      // Without a manifest nothing in flash can be trusted, so start clean
+      const bool erased = !manifest_load(state);
+      if (erased) {
+        disp_assets_update_progress("Erasing pics...");
         watchdog_refresh();
-        spiFlashErase_FONT();
-      #endif
+        spiFlashErase_PIC();
+        #if HAS_SPI_FLASH_FONT
+          disp_assets_update_progress("Erasing fonts...");
+          watchdog_refresh();
+          spiFlashErase_FONT();
+        #endif
+        manifest_reset();
+      }
+      else if (manifest_used + ASSET_KEYS > ASSET_MANIFEST_MAX)
+        manifest_reset(state);
 
       disp_assets_update_progress("Reading files...");
       dir_t d;
@@ -667,7 +871,7 @@ uint32_t Pic_Info_Write(uint8_t *P_name, uint32_t P_size) {
           else if (strstr(assets[a], "_preview"))
             assetType = ASSET_TYPE_G_PREVIEW;
 
-          loadAsset(dir, d, assets[a], assetType);
+          loadAsset(dir, d, assets[a], assetType, state[a], erased);
 
           continue;
         }
@@ -675,7 +879,7 @@ uint32_t Pic_Info_Write(uint8_t *P_name, uint32_t P_size) {
         #if HAS_SPI_FLASH_FONT
           a = arrayFindStr(fonts, COUNT(fonts), card.longFilename);
           if (a >= 0 && a < (int8_t)COUNT(fonts))
-            loadAsset(dir, d, fonts[a], ASSET_TYPE_FONT);
+            loadAsset(dir, d, fonts[a], ASSET_TYPE_FONT, state[COUNT(assets) + a], erased);
         #endif
       }
       dir.rename(&root, bakPath);
@@ -696,32 +900,6 @@ uint32_t Pic_Info_Write(uint8_t *P_name, uint32_t P_size) {
 
 #endif // SDSUPPORT
 
-void Pic_Read(uint8_t *Pname, uint8_t *P_Rbuff) {
-  uint8_t i, j;
-  uint8_t Pic_cnt;
-  uint32_t tmp_cnt = 0;
-  PIC_MSG PIC;
-
-  W25QXX.SPI_FLASH_BufferRead(&Pic_cnt, PIC_COUNTER_ADDR, 1);
-  if (Pic_cnt == 0xFF)
-    Pic_cnt = 0;
-
-  for (i = 0; i < Pic_cnt; i++) {
-    j = 0;
-    do {
-      W25QXX.SPI_FLASH_BufferRead(&PIC.name[j], PIC_NAME_ADDR + tmp_cnt, 1);
-      tmp_cnt++;
-    } while (PIC.name[j++] != '\0');
-    //pic size
-    W25QXX.SPI_FLASH_BufferRead(PIC.size.bytes, PIC_SIZE_ADDR + i * 4, 4);
-
-    if ((strcmp((char*)Pname, (char*)PIC.name)) == 0) {
-      W25QXX.SPI_FLASH_BufferRead((uint8_t *)P_Rbuff, PIC_DATA_ADDR_TFT35 + i * PER_PIC_MAX_SPACE_TFT35, PIC.size.dwords);
-      break;
-    }
-  }
-}
-
 void lv_pic_test(uint8_t *P_Rbuff, uint32_t addr, uint32_t size) {
   #if HAS_SPI_FLASH_COMPRESSION
     if (currentFlashPage == 0)
@@ -741,19 +919,36 @@ void lv_pic_test(uint8_t *P_Rbuff, uint32_t addr, uint32_t size) {
   }
 #endif
 
-uint32_t logo_addroffset = 0;
-void Pic_Logo_Read(uint8_t *LogoName, uint8_t *Logo_Rbuff, uint32_t LogoReadsize) {
+/**
+ * Copy an RGB565 image from SPI Flash into the open TFT window.
+ * Each half of the ping-pong buffer is refilled over SPI2 while the
+ * other half goes out to the TFT over SPI1. A half is only reused once
+ * the next transfer has started, which waits for its own DMA to finish.
+ */
+void Pic_Stream(uint32_t addr, uint32_t size) {
+  static uint16_t stream_buf[2][TFT_WIDTH];
   W25QXX.init(SPI_QUARTER_SPEED);
-  W25QXX.SPI_FLASH_BufferRead(Logo_Rbuff, PIC_LOGO_ADDR + logo_addroffset, LogoReadsize);
-  logo_addroffset += LogoReadsize;
-  if (logo_addroffset >= LOGO_MAX_SIZE_TFT35)
-    logo_addroffset = 0;
+  for (uint8_t i = 0; size; i ^= 1) {
+    const uint16_t n = _MIN(size, sizeof(stream_buf[i]));
+    W25QXX.SPI_FLASH_BufferRead((uint8_t *)stream_buf[i], addr, n);
+    #if ENABLED(LVGL_DMA_FLUSH)
+      SPI_TFT.tftio.WriteSequenceIT(stream_buf[i], n / 2);
+    #else
+      SPI_TFT.tftio.WriteSequence(stream_buf[i], n / 2);
+    #endif
+    addr += n;
+    size -= n;
+  }
+  TERN_(LVGL_DMA_FLUSH, while (SPI_TFT.tftio.isBusy()) { /* last half still going out */ });
+}
+
+void Pic_Logo_Stream() {
+  Pic_Stream(PIC_LOGO_ADDR, uint32_t(TFT_WIDTH) * (TFT_HEIGHT) * 2);
 }
 
 uint32_t default_view_addroffset = 0;
-void default_view_Read(uint8_t *default_view_Rbuff, uint32_t default_view_Readsize) {
-  W25QXX.init(SPI_QUARTER_SPEED);
-  W25QXX.SPI_FLASH_BufferRead(default_view_Rbuff, DEFAULT_VIEW_ADDR_TFT35 + default_view_addroffset, default_view_Readsize);
+void default_view_Stream(uint32_t default_view_Readsize) {
+  Pic_Stream(DEFAULT_VIEW_ADDR_TFT35 + default_view_addroffset, default_view_Readsize);
   default_view_addroffset += default_view_Readsize;
   if (default_view_addroffset >= DEFAULT_VIEW_MAX_SIZE)
     default_view_addroffset = 0;
@@ -761,9 +956,8 @@ void default_view_Read(uint8_t *default_view_Rbuff, uint32_t default_view_Readsi
 
 #if HAS_BAK_VIEW_IN_FLASH
   uint32_t flash_view_addroffset = 0;
-  void flash_view_Read(uint8_t *flash_view_Rbuff, uint32_t flash_view_Readsize) {
-    W25QXX.init(SPI_QUARTER_SPEED);
-    W25QXX.SPI_FLASH_BufferRead(flash_view_Rbuff, BAK_VIEW_ADDR_TFT35 + flash_view_addroffset, flash_view_Readsize);
+  void flash_view_Stream(uint32_t flash_view_Readsize, uint32_t flash_view_Showsize) {
+    Pic_Stream(BAK_VIEW_ADDR_TFT35 + flash_view_addroffset, _MIN(flash_view_Showsize, flash_view_Readsize));
     flash_view_addroffset += flash_view_Readsize;
     if (flash_view_addroffset >= FLASH_VIEW_MAX_SIZE)
       flash_view_addroffset = 0;
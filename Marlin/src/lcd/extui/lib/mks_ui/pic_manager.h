@@ -94,6 +94,8 @@
   #define FONTINFOADDR                  0x150000 // 6M -- font addr
   #define UNIGBK_FLASH_ADDR            (FONTINFOADDR+4096) // 4*1024
 
+  // No sector to spare for ASSET_MANIFEST_ADDR, so every asset update is a full one
+
 #else
   //pic
   // pic addr
@@ -118,11 +120,23 @@
   #define UNIGBK_FLASH_ADDR            (FONTINFOADDR+4096) // 4*1024
   #define GBK_FLASH_ADDR               (UNIGBK_FLASH_ADDR+180224) // 176*1024
 
+  // Checksums of the installed assets, for incremental updates
+  #if SPI_FLASH_SIZE == 0x800000
+    #define ASSET_MANIFEST_ADDR         0x7FE000 // Between the fonts and the flash flag
+  #else
+    #define ASSET_MANIFEST_ADDR         0xE00000
+  #endif
+
 #endif
 
 // Flash flag
 #define REFLSHE_FLGA_ADD                (0X800000-32)
 
+// Decoded G-code thumbnails
+#define THUMB_CACHE_ADDR                0xC00000
+#define THUMB_CACHE_SLOTS               16
+#define THUMB_SLOT_SIZE                 0x20000 // Header sector + small icon + large preview
+
 // SD card information first addr
 #define VAR_INF_ADDR                    0x000000
 #define FLASH_INF_VALID_FLAG            0x20210726
@@ -163,14 +177,14 @@ typedef struct pic_msg PIC_MSG;
 #define PIC_SIZE_xM   6
 #define FONT_SIZE_xM  2
 
-extern void Pic_Read(uint8_t *Pname, uint8_t *P_Rbuff);
-extern void Pic_Logo_Read(uint8_t *LogoName,uint8_t *Logo_Rbuff,uint32_t LogoReadsize);
+extern void Pic_Stream(uint32_t addr, uint32_t size);
+extern void Pic_Logo_Stream();
 extern void lv_pic_test(uint8_t *P_Rbuff, uint32_t addr, uint32_t size);
 extern uint32_t lv_get_pic_addr(uint8_t *Pname);
 extern void get_spi_flash_data(const char *rec_buf, int offset, int size);
 extern void spi_flash_read_test();
-extern void default_view_Read(uint8_t *default_view_Rbuff, uint32_t default_view_Readsize);
-extern void flash_view_Read(uint8_t *flash_view_Rbuff, uint32_t flash_view_Readsize);
+extern void default_view_Stream(uint32_t default_view_Readsize);
+extern void flash_view_Stream(uint32_t flash_view_Readsize, uint32_t flash_view_Showsize);
 
 #ifdef __cplusplus
   } /* C-declarations for C++ */
@@ -185,7 +185,9 @@ void printer_state_polling() {
 
   if (uiCfg.print_state == WORKING) filament_check();
 
-  TERN_(MKS_WIFI_MODULE, wifi_looping());
+  #if ENABLED(MKS_WIFI_MODULE)
+    if (TERN1(LVGL_DEFERRED_INIT, lv_deferred_init())) wifi_looping();
+  #endif
 }
 
 void filament_pin_setup() {
@@ -62,6 +62,10 @@ XPT2046 touch;
   #include "wifi_module.h"
 #endif
 
+#if ENABLED(LVGL_THUMB_CACHE)
+  #include "thumb_cache.h"
+#endif
+
 #include <SPI.h>
 
 #ifndef TFT_WIDTH
@@ -76,6 +80,11 @@ XPT2046 touch;
 #endif
 
 static lv_disp_buf_t disp_buf;
+
+#if ENABLED(LVGL_DEFERRED_INIT)
+  static millis_t logo_until; // = 0
+  TERN_(MKS_WIFI_MODULE, static bool wifi_started); // = false
+#endif
 lv_group_t*  g;
 #if ENABLED(SDSUPPORT)
   extern void UpdateAssets();
@@ -83,7 +92,7 @@ lv_group_t*  g;
 uint16_t DeviceCode = 0x9488;
 extern uint8_t sel_id;
 
-uint8_t bmp_public_buf[14 * 1024];
+uint8_t bmp_public_buf[BMP_PUBLIC_BUF_SIZE];
 uint8_t public_buf[513];
 
 extern bool flash_preview_begin, default_preview_flg, gcode_preview_over;
@@ -143,13 +152,17 @@ void tft_lvgl_init() {
     } while((!Sd2Card::isInserted()) && (usb_flash_loop--));
     card.mount();
   #elif HAS_LOGO_IN_FLASH
-    delay(2000);
+    #if ENABLED(LVGL_DEFERRED_INIT)
+      logo_until = millis() + 2000; // Keep the logo up while the rest of setup() runs
+    #else
+      delay(2000);
+    #endif
   #endif
   
   watchdog_refresh();     // LVGL init takes time
 
   #if ENABLED(SDSUPPORT)
-    UpdateAssets();
+    BOOT_STAGE(UpdateAssets());
     watchdog_refresh();   // LVGL init takes time
   #endif
 
@@ -157,9 +170,15 @@ void tft_lvgl_init() {
 
   touch.Init();
 
-  lv_init();
+  BOOT_STAGE(lv_init());
 
-  lv_disp_buf_init(&disp_buf, bmp_public_buf, nullptr, LV_HOR_RES_MAX * 15); /*Initialize the display buffer*/
+  #if ENABLED(LVGL_DMA_FLUSH)
+    // Two partial buffers: LVGL renders into one while DMA sends the other
+    constexpr uint32_t disp_buf_px = (sizeof(bmp_public_buf) / 2 / sizeof(lv_color_t)) / (LV_HOR_RES_MAX) * (LV_HOR_RES_MAX);
+    lv_disp_buf_init(&disp_buf, bmp_public_buf, &bmp_public_buf[disp_buf_px * sizeof(lv_color_t)], disp_buf_px);
+  #else
+    lv_disp_buf_init(&disp_buf, bmp_public_buf, nullptr, sizeof(bmp_public_buf) / sizeof(lv_color_t) / (LV_HOR_RES_MAX) * (LV_HOR_RES_MAX)); /*Initialize the display buffer*/
+  #endif
 
   lv_disp_drv_t disp_drv;     /*Descriptor of a display driver*/
   lv_disp_drv_init(&disp_drv);    /*Basic initialization*/
@@ -206,7 +225,7 @@ void tft_lvgl_init() {
   systick_attach_callback(SysTick_Callback);
 
   #if HAS_SPI_FLASH_FONT
-    init_gb2312_font();
+    BOOT_STAGE(init_gb2312_font());
   #endif
 
   tft_style_init();
@@ -216,17 +235,21 @@ void tft_lvgl_init() {
   lv_encoder_pin_init();
 
   #if ENABLED(MKS_WIFI_MODULE)
-    mks_esp_wifi_init();
-    //WIFISERIAL.begin(WIFI_BAUDRATE);
-    //uint32_t serial_connect_timeout = millis() + 1000UL;
-    //while (/*!WIFISERIAL && */PENDING(millis(), serial_connect_timeout)) { /*nada*/ }
-    mks_wifi_firmware_upddate();
+    // Deferred, unless the module's firmware is to be updated before the UI starts
+    if (TERN1(LVGL_DEFERRED_INIT, card.fileExists(ESP_FIRMWARE_FILE))) {
+      BOOT_STAGE(mks_esp_wifi_init());
+      //WIFISERIAL.begin(WIFI_BAUDRATE);
+      //uint32_t serial_connect_timeout = millis() + 1000UL;
+      //while (/*!WIFISERIAL && */PENDING(millis(), serial_connect_timeout)) { /*nada*/ }
+      mks_wifi_firmware_upddate();
+      TERN_(LVGL_DEFERRED_INIT, wifi_started = true);
+    }
   #endif
   TERN_(HAS_SERVOS, servo_init());
   TERN_(HAS_Z_SERVO_PROBE, probe.servo_probe_init());
   bool ready = true;
   #if ENABLED(POWER_LOSS_RECOVERY)
-    recovery.load();
+    BOOT_STAGE(recovery.load());
     if (recovery.valid()) {
       ready = false;
       if (gCfgItems.from_flash_pic)
@@ -251,19 +274,68 @@ void tft_lvgl_init() {
     mks_gpio_test();
 }
 
-void my_disp_flush(lv_disp_drv_t * disp, const lv_area_t * area, lv_color_t * color_p) {
-  uint16_t width = area->x2 - area->x1 + 1,
-          height = area->y2 - area->y1 + 1;
+#if ENABLED(LVGL_DEFERRED_INIT)
+
+  /**
+   * Run the parts of tft_lvgl_init() put off until after setup(), one per call.
+   * The screen built by tft_lvgl_init() is drawn once the logo has had its time.
+   */
+  bool lv_deferred_init() {
+    if (logo_until) {
+      if (PENDING(millis(), logo_until)) return false;
+      logo_until = 0;
+    }
+    #if ENABLED(MKS_WIFI_MODULE)
+      if (!wifi_started) {
+        wifi_started = true;
+        BOOT_STAGE_DEFERRED(mks_esp_wifi_init());
+        return false;
+      }
+    #endif
+    return true;
+  }
+
+#endif
 
-  SPI_TFT.setWindow((uint16_t)area->x1, (uint16_t)area->y1, width, height);
+#if ENABLED(LVGL_DMA_FLUSH)
 
-  for (uint16_t i = 0; i < height; i++)
-    SPI_TFT.tftio.WriteSequence((uint16_t*)(color_p + width * i), width);
+  static lv_disp_drv_t *disp_drv_p;
 
-  lv_disp_flush_ready(disp);       /* Indicate you are ready with the flushing*/
+  // DMA complete interrupt: hand the buffer back to LVGL
+  static void lv_flush_done() { lv_disp_flush_ready(disp_drv_p); }
 
-  W25QXX.init(SPI_QUARTER_SPEED);
-}
+  // Wait for a background flush before using the TFT bus or bmp_public_buf
+  void lv_flush_wait() { while (SPI_TFT.tftio.isBusy()) { /* nada */ } }
+
+  void my_disp_flush(lv_disp_drv_t * disp, const lv_area_t * area, lv_color_t * color_p) {
+    const uint16_t width = area->x2 - area->x1 + 1,
+                  height = area->y2 - area->y1 + 1;
+
+    disp_drv_p = disp;
+    SPI_TFT.setWindow((uint16_t)area->x1, (uint16_t)area->y1, width, height);
+    // The area is contiguous in the buffer, so send it as one transfer
+    SPI_TFT.tftio.WriteSequenceIT((uint16_t*)color_p, width * height, lv_flush_done);
+  }
+
+#else
+
+  void lv_flush_wait() {}
+
+  void my_disp_flush(lv_disp_drv_t * disp, const lv_area_t * area, lv_color_t * color_p) {
+    uint16_t width = area->x2 - area->x1 + 1,
+            height = area->y2 - area->y1 + 1;
+
+    SPI_TFT.setWindow((uint16_t)area->x1, (uint16_t)area->y1, width, height);
+
+    for (uint16_t i = 0; i < height; i++)
+      SPI_TFT.tftio.WriteSequence((uint16_t*)(color_p + width * i), width);
+
+    lv_disp_flush_ready(disp);       /* Indicate you are ready with the flushing*/
+
+    W25QXX.init(SPI_QUARTER_SPEED);
+  }
+
+#endif
 
 void lv_fill_rect(lv_coord_t x1, lv_coord_t y1, lv_coord_t x2, lv_coord_t y2, lv_color_t bk_color) {
   uint16_t width, height;
@@ -294,6 +366,7 @@ unsigned int getTickDiff(unsigned int curTick, unsigned int lastTick) {
 }
 
 static bool get_point(int16_t *x, int16_t *y) {
+  lv_flush_wait(); // The touch controller shares the TFT SPI port
   bool is_touched = touch.getRawPoint(x, y);
 
   if (!is_touched) return false;
@@ -415,7 +488,37 @@ lv_fs_res_t spi_flash_tell_cb(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p
 char *cur_namefff;
 uint32_t sd_read_base_addr = 0, sd_read_addr_offset = 0, small_image_size = 409;
 char last_path[(SHORT_NAME_LEN + 1) * MAX_DIR_LEVEL + strlen("S:/") + 1];
+#if ENABLED(LVGL_THUMB_CACHE)
+
+  static int8_t thumb_slot = -1;  // Slot serving the open icon, or -1 to read it from SD
+  static uint32_t thumb_pos;
+
+  // Decode the small icon of a file from SD into a cache slot, claiming one
+  // after the first row if the file has none. Return the slot or -1.
+  static int8_t thumb_decode_small(int8_t slot, char *path) {
+    if (lv_open_gcode_file(path) == UINT32_MAX) return -1;
+    uint8_t row[200];
+    bool ok = true;
+    for (uint16_t y = 0; ok && y < 100; y++) {
+      ok = card.isFileOpen();
+      if (ok) {
+        lv_gcode_file_read(row);
+        if (slot < 0) ok = (slot = thumb_cache.claim(path)) >= 0;
+        if (ok) thumb_cache.write(slot, THUMB_SMALL, uint32_t(y) * sizeof(row), row, sizeof(row));
+      }
+    }
+    lv_close_gcode_file();
+    if (!ok) return -1;
+    thumb_cache.finish(slot, THUMB_SMALL);
+    return slot;
+  }
+
+#endif
+
 lv_fs_res_t sd_open_cb (lv_fs_drv_t * drv, void * file_p, const char * path, lv_fs_mode_t mode) {
+  #if ENABLED(LVGL_THUMB_CACHE)
+    if (path != nullptr && thumb_slot >= 0 && strcmp((const char*)path, (const char*)last_path) == 0) return LV_FS_RES_OK;
+  #endif
   if (path != nullptr && card.isFileOpen() && strcmp((const char*)path, (const char*)last_path) == 0) return LV_FS_RES_OK;
   strcpy(last_path, path);
   lv_close_gcode_file();
@@ -424,6 +527,12 @@ lv_fs_res_t sd_open_cb (lv_fs_drv_t * drv, void * file_p, const char * path, lv_
   strcpy(name_buf + 1, path);
   char *temp = strstr(name_buf, ".bin");
   if (temp) strcpy(temp, ".GCO");
+  #if ENABLED(LVGL_THUMB_CACHE)
+    thumb_slot = thumb_cache.find(name_buf);
+    if (thumb_slot < 0 || !thumb_cache.has(thumb_slot, THUMB_SMALL))
+      thumb_slot = thumb_decode_small(thumb_slot, name_buf);
+    if (thumb_slot >= 0) { thumb_pos = 0; return LV_FS_RES_OK; }
+  #endif
   sd_read_base_addr = lv_open_gcode_file((char *)name_buf);
   sd_read_addr_offset = sd_read_base_addr;
   if (sd_read_addr_offset == UINT32_MAX) return LV_FS_RES_NOT_EX;
@@ -442,6 +551,14 @@ lv_fs_res_t sd_close_cb (lv_fs_drv_t * drv, void * file_p) {
 }
 
 lv_fs_res_t sd_read_cb (lv_fs_drv_t * drv, void * file_p, void * buf, uint32_t btr, uint32_t * br) {
+  #if ENABLED(LVGL_THUMB_CACHE)
+    if (thumb_slot >= 0 && btr != 4) {
+      thumb_cache.read(thumb_slot, THUMB_SMALL, thumb_pos - 4, (uint8_t *)buf, btr);
+      thumb_pos += btr;
+      *br = btr;
+      return LV_FS_RES_OK;
+    }
+  #endif
   if (btr == 200) {
     lv_gcode_file_read((uint8_t *)buf);
     //pic_read_addr_offset += 208;
@@ -456,12 +573,18 @@ lv_fs_res_t sd_read_cb (lv_fs_drv_t * drv, void * file_p, void * buf, uint32_t b
 }
 
 lv_fs_res_t sd_seek_cb(lv_fs_drv_t * drv, void * file_p, uint32_t pos) {
+  #if ENABLED(LVGL_THUMB_CACHE)
+    if (thumb_slot >= 0) { thumb_pos = pos; return LV_FS_RES_OK; }
+  #endif
   sd_read_addr_offset = sd_read_base_addr + (pos - 4) / 200 * small_image_size;
   lv_gcode_file_seek(sd_read_addr_offset);
   return LV_FS_RES_OK;
 }
 
 lv_fs_res_t sd_tell_cb(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p) {
+  #if ENABLED(LVGL_THUMB_CACHE)
+    if (thumb_slot >= 0) { *pos_p = thumb_pos; return LV_FS_RES_OK; }
+  #endif
   if (sd_read_addr_offset) *pos_p = 0;
   else *pos_p = (sd_read_addr_offset - sd_read_base_addr) / small_image_size * 200 + 4;
   return LV_FS_RES_OK;
@@ -34,10 +34,14 @@
 
 //#define TFT_ROTATION TFT_ROTATE_180
 
-extern uint8_t bmp_public_buf[14 * 1024];
+// LVGL draw buffer, also used by the WiFi FIFO, the G-code preview and the asset update
+#define BMP_PUBLIC_BUF_SIZE (10 * 1024)
+
+extern uint8_t bmp_public_buf[BMP_PUBLIC_BUF_SIZE];
 extern uint8_t public_buf[513];
 
 extern void tft_lvgl_init();
+extern void lv_flush_wait();
 extern void my_disp_flush(lv_disp_drv_t * disp, const lv_area_t * area, lv_color_t * color_p);
 extern bool my_touchpad_read(lv_indev_drv_t * indev_driver, lv_indev_data_t * data);
 extern bool my_mousewheel_read(lv_indev_drv_t * indev_drv, lv_indev_data_t * data);
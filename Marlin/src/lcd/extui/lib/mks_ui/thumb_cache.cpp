@@ -0,0 +1,154 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../../inc/MarlinConfigPre.h"
+
+#if HAS_TFT_LVGL_UI && ENABLED(LVGL_THUMB_CACHE)
+
+#include "../../../../inc/MarlinConfig.h"
+#include "../../../../libs/W25Qxx.h"
+#include "../../../../sd/cardreader.h"
+#include "pic_manager.h"
+#include "thumb_cache.h"
+
+#define THUMB_MARKER 0x5443
+
+// Start of each part within a slot, after the header sector
+static constexpr uint32_t part_offset[] = { SPI_FLASH_SectorSize, SPI_FLASH_SectorSize + 0x5000 };
+
+static_assert(100 * 100 * 2 <= 0x5000, "The small thumbnail overlaps the large one.");
+static_assert(part_offset[THUMB_LARGE] + 200 * 200 * 2 <= THUMB_SLOT_SIZE, "THUMB_SLOT_SIZE is too small for the large thumbnail.");
+static_assert(THUMB_CACHE_ADDR + uint32_t(THUMB_CACHE_SLOTS) * THUMB_SLOT_SIZE <= SPI_FLASH_SIZE, "The thumbnail cache doesn't fit in SPI Flash.");
+static_assert(THUMB_CACHE_SLOTS <= 127, "THUMB_CACHE_SLOTS must fit in a slot index.");
+
+ThumbCache thumb_cache;
+
+uint32_t ThumbCache::erased_end[2];
+
+static inline uint32_t slot_addr(const int8_t slot) { return THUMB_CACHE_ADDR + uint32_t(slot) * THUMB_SLOT_SIZE; }
+
+/**
+ * Fill in the key of a file: its path plus the size and last write time
+ * from its directory entry. Return false if the file can't be found.
+ */
+bool ThumbCache::file_key(const char * const path, thumb_header_t &hdr) {
+  SdFile *curDir;
+  const char * const fname = card.diveToFile(false, curDir, path);
+  if (!fname) return false;
+
+  SdFile file;
+  dir_t dir;
+  const bool ok = file.open(curDir, fname, O_READ) && file.dirEntry(&dir);
+  file.close();
+  if (!ok) return false;
+
+  hdr.size = dir.fileSize;
+  hdr.date = dir.lastWriteDate;
+  hdr.time = dir.lastWriteTime;
+  // The file list and the icon loader spell the root differently
+  const char *name = path;
+  while (*name == '/') name++;
+  ZERO(hdr.path);
+  strncpy(hdr.path, name, sizeof(hdr.path) - 1);
+  return true;
+}
+
+/**
+ * Return the slot holding the thumbnails of a file, or -1 on a miss.
+ * Nothing is written.
+ */
+int8_t ThumbCache::find(const char * const path) {
+  thumb_header_t key, hdr;
+  if (!file_key(path, key)) return -1;
+
+  W25QXX.init(SPI_QUARTER_SPEED);
+
+  LOOP_L_N(i, THUMB_CACHE_SLOTS) {
+    W25QXX.SPI_FLASH_BufferRead((uint8_t*)&hdr, slot_addr(i), sizeof(hdr));
+    if (hdr.marker == THUMB_MARKER && hdr.size == key.size && hdr.date == key.date && hdr.time == key.time
+      && !memcmp(hdr.path, key.path, sizeof(key.path))
+    ) return i;
+  }
+  return -1;
+}
+
+/**
+ * Give a file that missed a slot, with every part pending. Use a free
+ * slot, or else the first one claimed. Return -1 if the file can't be keyed.
+ */
+int8_t ThumbCache::claim(const char * const path) {
+  thumb_header_t key, hdr;
+  if (!file_key(path, key)) return -1;
+
+  W25QXX.init(SPI_QUARTER_SPEED);
+
+  int8_t victim = 0;
+  bool have_free = false;
+  uint32_t victim_seq = UINT32_MAX, next_seq = 0;
+  LOOP_L_N(i, THUMB_CACHE_SLOTS) {
+    W25QXX.SPI_FLASH_BufferRead((uint8_t*)&hdr, slot_addr(i), sizeof(hdr));
+    if (hdr.marker != THUMB_MARKER) {
+      if (!have_free) { have_free = true; victim = i; }
+      continue;
+    }
+    NOLESS(next_seq, hdr.seq + 1);
+    if (!have_free && hdr.seq < victim_seq) { victim = i; victim_seq = hdr.seq; }
+  }
+
+  key.marker = THUMB_MARKER;
+  key.pending = 0xFF;
+  key.reserved = 0xFF;
+  key.seq = next_seq;
+  W25QXX.SPI_FLASH_SectorErase(slot_addr(victim));
+  W25QXX.SPI_FLASH_BufferWrite((uint8_t*)&key, slot_addr(victim), sizeof(key));
+  return victim;
+}
+
+bool ThumbCache::has(const int8_t slot, const ThumbPart part) {
+  thumb_header_t hdr;
+  W25QXX.SPI_FLASH_BufferRead((uint8_t*)&hdr, slot_addr(slot), sizeof(hdr));
+  return hdr.marker == THUMB_MARKER && !TEST(hdr.pending, part);
+}
+
+void ThumbCache::read(const int8_t slot, const ThumbPart part, const uint32_t offset, uint8_t *data, const uint16_t len) {
+  W25QXX.SPI_FLASH_BufferRead(data, slot_addr(slot) + part_offset[part] + offset, len);
+}
+
+void ThumbCache::write(const int8_t slot, const ThumbPart part, const uint32_t offset, uint8_t *data, const uint16_t len) {
+  const uint32_t base = slot_addr(slot) + part_offset[part];
+  if (offset == 0) erased_end[part] = 0;
+  while (erased_end[part] < offset + len) {
+    W25QXX.SPI_FLASH_SectorErase(base + erased_end[part]);
+    erased_end[part] += SPI_FLASH_SectorSize;
+  }
+  W25QXX.SPI_FLASH_BufferWrite(data, base + offset, len);
+}
+
+// Clearing bits needs no erase, so the pending flags are updated in place
+void ThumbCache::finish(const int8_t slot, const ThumbPart part) {
+  thumb_header_t hdr;
+  W25QXX.SPI_FLASH_BufferRead((uint8_t*)&hdr, slot_addr(slot), sizeof(hdr));
+  CBI(hdr.pending, part);
+  W25QXX.SPI_FLASH_BufferWrite(&hdr.pending, slot_addr(slot) + offsetof(thumb_header_t, pending), 1);
+}
+
+#endif // HAS_TFT_LVGL_UI && LVGL_THUMB_CACHE
@@ -0,0 +1,70 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * @file lcd/extui/lib/mks_ui/thumb_cache.h
+ *
+ * Decoded G-code thumbnails kept in SPI Flash, so the ";simage:" and
+ * ";gimage:" hex text is only parsed once per file.
+ */
+
+#include <stdint.h>
+
+enum ThumbPart : uint8_t {
+  THUMB_SMALL = 0,  // 100x100 file list icon
+  THUMB_LARGE = 1   // 200x200 print preview
+};
+
+typedef struct {
+  uint16_t marker;          // THUMB_MARKER once the slot is claimed
+  uint8_t  pending;         // One bit per ThumbPart, cleared in place when the part is complete
+  uint8_t  reserved;
+  uint32_t seq;             // Claim order, the lowest is evicted first (FIFO)
+  uint32_t size;            // File size, date and time, so an edited file misses
+  uint16_t date, time;
+  char     path[64];        // Leading part of the SD path
+} thumb_header_t;
+
+/**
+ * Each slot owns THUMB_SLOT_SIZE bytes of SPI Flash: a header sector,
+ * then the RGB565 pixels of each part. A slot is claimed for a file once
+ * the first row of a thumbnail has been decoded, so files without one
+ * never evict anything. Slots are evicted in claim order, as a hit would
+ * cost a flash write to record. Writes to a part run from its start,
+ * erasing each sector just before it is reached.
+ */
+class ThumbCache {
+  public:
+    static int8_t find(const char * const path);
+    static int8_t claim(const char * const path);
+    static bool has(const int8_t slot, const ThumbPart part);
+    static void read(const int8_t slot, const ThumbPart part, const uint32_t offset, uint8_t *data, const uint16_t len);
+    static void write(const int8_t slot, const ThumbPart part, const uint32_t offset, uint8_t *data, const uint16_t len);
+    static void finish(const int8_t slot, const ThumbPart part);
+
+  private:
+    static uint32_t erased_end[2];  // End of the erased area of the part being written
+    static bool file_key(const char * const path, thumb_header_t &hdr);
+};
+
+extern ThumbCache thumb_cache;
@@ -45,6 +45,20 @@
 #if ENABLED(PARK_HEAD_ON_PAUSE)
   #include "../../../../feature/pause.h"
 #endif
+#if ENABLED(STATUS_SNAPSHOT)
+  #include "../../../../feature/status_snapshot.h"
+#endif
+
+#if ENABLED(MKS_WIFI_MEATPACK)
+  #include "../../../../feature/meatpack.h"
+#endif
+
+#if ENABLED(MKS_WIFI_COMPRESSED_UPLOAD)
+  #include "../../../../libs/heatshrink/heatshrink_decoder.h"
+  #include "../../../../libs/crc16.h"
+#endif
+
+static_assert(TRANS_RCV_FIFO_BLOCK_NUM * UDISKBUFLEN <= BMP_PUBLIC_BUF_SIZE, "The WiFi receive FIFO doesn't fit in bmp_public_buf.");
 
 #define WIFI_SET()        WRITE(WIFI_RESET_PIN, HIGH);
 #define WIFI_RESET()      WRITE(WIFI_RESET_PIN, LOW);
@@ -210,6 +224,117 @@ static bool longName2DosName(const char *longName, uint8_t *dosName) {
     }
   }
 
+  #if ENABLED(MKS_WIFI_DMA_RX)
+
+  /**
+   * Uploads are received by DMA into a ring over the whole receive FIFO
+   * that never stops, so no byte is lost while the FIFO is being written
+   * to SD. The DMA half / full and the USART idle line interrupts count
+   * what has arrived, so the tail of a frame is seen as soon as the ESP
+   * pauses. WIFI_IO1 holds the ESP off while less than two frames are free.
+   */
+  #define RX_RING_SIZE ((TRANS_RCV_FIFO_BLOCK_NUM) * (UDISKBUFLEN))
+  #define RX_RING_LOW  (2 * (UDISKBUFLEN))
+
+  static uint8_t * const rx_ring = bmp_public_buf;
+  static volatile uint32_t rx_received,   // Bytes written by the DMA
+                           rx_consumed;   // Bytes taken by wifi_rcv_handle
+  static volatile uint16_t rx_last_pos;
+  static volatile bool rx_held, rx_failed;
+
+  static struct {
+    uint32_t holds,           // Times the ESP was held off
+             overruns,        // Times the ring was overrun
+             usart_overruns;  // Bytes lost before the DMA took them
+    uint16_t peak;            // Most bytes waiting
+  } rx_stats;
+
+  // Count what the DMA wrote since the last call. Its interrupts come every
+  // half ring, so the position can't wrap around unseen.
+  static void rx_ring_update() {
+    const uint16_t pos = RX_RING_SIZE - dma_tube_regs(DMA1, DMA_CH5)->CNDTR;
+    rx_received += (pos + RX_RING_SIZE - rx_last_pos) % RX_RING_SIZE;
+    rx_last_pos = pos;
+  }
+
+  // Update the count and hold the ESP off if the ring is nearly full. Called from the interrupts.
+  static void rx_ring_check() {
+    rx_ring_update();
+    const uint32_t waiting = rx_received - rx_consumed;
+    if (waiting > rx_stats.peak) rx_stats.peak = _MIN(waiting, uint32_t(RX_RING_SIZE));
+    if (!rx_held && waiting > RX_RING_SIZE - RX_RING_LOW) {
+      rx_held = true;
+      rx_stats.holds++;
+      WIFI_IO1_SET();
+    }
+  }
+
+  static void dma_ch5_irq_handle() {
+    const uint8 status_bits = dma_get_isr_bits(DMA1, DMA_CH5);
+    dma_clear_isr_bits(DMA1, DMA_CH5);
+    if (status_bits & 0x8)
+      rx_failed = true;   // DMA transmit error, the channel is off
+    else
+      rx_ring_check();
+  }
+
+  // USART1 idle line, between frames or after the last one
+  void wifi_rx_idle_irq() {
+    if (USART1_BASE->SR & USART_SR_ORE) rx_stats.usart_overruns++;
+    (void)USART1_BASE->DR;  // Clear IDLE and ORE
+    rx_ring_check();
+  }
+
+  static void wifi_usart_dma_init() {
+    dma_init(DMA1);
+    dma_setup_transfer(DMA1, DMA_CH5, &USART1_BASE->DR, DMA_SIZE_8BITS, rx_ring, DMA_SIZE_8BITS,
+                       DMA_MINC_MODE | DMA_CIRC_MODE | DMA_TRNS_CMPLT | DMA_HALF_TRNS | DMA_TRNS_ERR);
+    dma_set_priority(DMA1, DMA_CH5, DMA_PRIORITY_HIGH);
+    dma_attach_interrupt(DMA1, DMA_CH5, &dma_ch5_irq_handle);
+    dma_clear_isr_bits(DMA1, DMA_CH5);
+    dma_set_num_transfers(DMA1, DMA_CH5, RX_RING_SIZE);
+
+    rx_received = rx_consumed = rx_last_pos = 0;
+    rx_held = rx_failed = false;
+
+    bb_peri_set_bit(&USART1_BASE->CR3, USART_CR3_DMAR_BIT, 1);
+    USART1_BASE->CR1 |= USART_CR1_IDLEIE;
+    dma_enable(DMA1, DMA_CH5);
+  }
+
+  // Take up to len bytes from the ring. Return -1 if data was lost.
+  static int32_t rx_ring_read(uint8_t *buf, const uint32_t len) {
+    const uint32_t start = rx_consumed;
+    DISABLE_ISRS();
+    rx_ring_update();
+    const uint32_t n = _MIN(rx_received - start, len);
+    ENABLE_ISRS();
+
+    const uint16_t pos = start % RX_RING_SIZE, first = _MIN(n, uint32_t(RX_RING_SIZE - pos));
+    memcpy(buf, &rx_ring[pos], first);
+    memcpy(buf + first, rx_ring, n - first);
+
+    // The DMA may have written over the bytes while they were copied
+    DISABLE_ISRS();
+    rx_ring_update();
+    const bool lost = rx_failed || rx_received - start > RX_RING_SIZE;
+    rx_consumed = start + n;
+    const bool resume = rx_held && rx_received - rx_consumed <= RX_RING_SIZE - RX_RING_LOW;
+    if (resume) rx_held = false;
+    ENABLE_ISRS();
+
+    if (lost) { rx_stats.overruns++; return -1; }
+    if (resume && wifiTransError.flag != 0x1) WIFI_IO1_RESET();
+    return n;
+  }
+
+  void wifi_rx_report() {
+    SERIAL_ECHOLNPAIR("WiFi RX ring:", RX_RING_SIZE, " peak:", rx_stats.peak, " holds:", rx_stats.holds,
+                      " overruns:", rx_stats.overruns, " USART overruns:", rx_stats.usart_overruns);
+  }
+
+  #else
+
   static int storeRcvData(volatile uint8_t *bufToCpy, int32_t len) {
     unsigned char tmpW = wifiDmaRcvFifo.write_cur;
     if (len > UDISKBUFLEN) return 0;
@@ -284,6 +409,8 @@ static bool longName2DosName(const char *longName, uint8_t *dosName) {
     wifiDmaRcvFifo.write_cur = 0;
   }
 
+  #endif // !MKS_WIFI_DMA_RX
+
   void esp_port_begin(uint8_t interrupt) {
     WifiRxFifo.uart_read_point = 0;
     WifiRxFifo.uart_write_point = 0;
@@ -879,6 +1006,131 @@ int write_to_file(char *buf, int len) {
   return 0;
 }
 
+#if ENABLED(MKS_WIFI_COMPRESSED_UPLOAD)
+
+  /**
+   * A compressed upload is a heatshrink stream (-w 8 -l 4, as in heatshrink_config.h)
+   * cut into blocks, each with its size and CRC16. A block of size 0 ends it, followed
+   * by the size of the unpacked file. All values are little-endian.
+   *
+   *   "HSGC" { size:uint16 crc:uint16 data[size] }... { 0:uint16 0:uint16 } length:uint32
+   *
+   * The blocks are unpacked into the SD write buffer as they arrive, so the file is
+   * stored as G-code. Made by buildroot/share/scripts/mks_wifi_pack.py. An upload
+   * without the tag is stored as it was sent.
+   */
+  #define UPLOAD_PACK_TAG "HSGC"
+
+  enum UploadUnpackState : uint8_t { UNPACK_TAG, UNPACK_RAW, UNPACK_HEADER, UNPACK_DATA, UNPACK_LENGTH, UNPACK_DONE };
+
+  static struct {
+    UploadUnpackState state;
+    uint8_t head[4], head_used;   // The tag, a block header or the length, as it comes in
+    uint16_t left,                // Bytes left in the block
+             crc, block_crc;
+    uint32_t length;              // Unpacked so far
+  } unpack;
+
+  static heatshrink_decoder upload_hsd;
+
+  static void upload_unpack_reset() {
+    unpack.state = UNPACK_TAG;
+    unpack.head_used = 0;
+    unpack.length = 0;
+    heatshrink_decoder_reset(&upload_hsd);
+  }
+
+  // Move the unpacked bytes to the SD write buffer
+  static int upload_unpack_drain() {
+    uint8_t out[64];
+    size_t count;
+    HSD_poll_res pres;
+    do {
+      pres = heatshrink_decoder_poll(&upload_hsd, out, sizeof(out), &count);
+      if (pres < 0 || (count && write_to_file((char *)out, count) < 0)) return -1;
+      unpack.length += count;
+    } while (pres == HSDR_POLL_MORE);
+    return 0;
+  }
+
+  // Take the data of a fragment, unpacking it if the upload started with the tag
+  static int upload_write(char *buf, int len) {
+    while (len > 0) {
+      switch (unpack.state) {
+        case UNPACK_RAW: return write_to_file(buf, len);
+
+        case UNPACK_DONE: return -1;  // Nothing may follow the end
+
+        case UNPACK_DATA: {
+          const uint16_t n = _MIN(len, int(unpack.left));
+          crc16(&unpack.crc, buf, n);
+          for (size_t sunk = 0; sunk < n;) {
+            size_t count;
+            if (heatshrink_decoder_sink(&upload_hsd, (uint8_t *)buf + sunk, n - sunk, &count) < 0) return -1;
+            sunk += count;
+            if (upload_unpack_drain() < 0) return -1;
+          }
+          buf += n;
+          len -= n;
+          unpack.left -= n;
+          if (!unpack.left) {
+            if (unpack.crc != unpack.block_crc) return -1;
+            unpack.state = UNPACK_HEADER;
+          }
+        } break;
+
+        default: {  // Four bytes of tag, header or length
+          const uint8_t n = _MIN(len, 4 - unpack.head_used);
+          memcpy(&unpack.head[unpack.head_used], buf, n);
+          buf += n;
+          len -= n;
+          if ((unpack.head_used += n) < 4) break;
+          unpack.head_used = 0;
+
+          const uint8_t * const h = unpack.head;
+          switch (unpack.state) {
+            case UNPACK_TAG:
+              if (memcmp(h, UPLOAD_PACK_TAG, 4) == 0)
+                unpack.state = UNPACK_HEADER;
+              else {
+                unpack.state = UNPACK_RAW;
+                if (write_to_file((char *)unpack.head, 4) < 0) return -1;
+              }
+              break;
+
+            case UNPACK_HEADER:
+              unpack.left = h[0] | (h[1] << 8);
+              unpack.block_crc = h[2] | (h[3] << 8);
+              unpack.crc = 0;
+              unpack.state = unpack.left ? UNPACK_DATA : UNPACK_LENGTH;
+              break;
+
+            default: {  // UNPACK_LENGTH
+              while (heatshrink_decoder_finish(&upload_hsd) == HSDR_FINISH_MORE)
+                if (upload_unpack_drain() < 0) return -1;
+              const uint32_t length = h[0] | (h[1] << 8) | (uint32_t(h[2]) << 16) | (uint32_t(h[3]) << 24);
+              if (length != unpack.length) return -1;
+              unpack.state = UNPACK_DONE;
+            } break;
+          }
+        } break;
+      }
+    }
+    return 0;
+  }
+
+  // After the last fragment. An upload cut short fails, a short file without the tag is stored.
+  static int upload_finish() {
+    switch (unpack.state) {
+      case UNPACK_TAG: return write_to_file((char *)unpack.head, unpack.head_used);
+      case UNPACK_RAW:
+      case UNPACK_DONE: return 0;
+      default: return -1;
+    }
+  }
+
+#endif
+
 #define ESP_PROTOC_HEAD (uint8_t)0xA5
 #define ESP_PROTOC_TAIL   (uint8_t)0xFC
 
@@ -953,6 +1205,39 @@ uint8_t Explore_Disk(char* path , uint8_t recu_level) {
   return fileCnt;
 }
 
+#if ENABLED(STATUS_SNAPSHOT)
+
+  // The M105 (tenths) and M991 (whole degrees) replies, rebuilt with the status snapshot
+  static const char* wifi_temps(const bool tenths) {
+    static char text[2][100];
+    static uint8_t stamp[2];
+    status_snapshot.refresh();
+    if (stamp[tenths] == status_snapshot.stamp) return text[tenths];
+    stamp[tenths] = status_snapshot.stamp;
+
+    char *p = text[tenths];
+    auto add = [&](PGM_P const label, const float c, const float t) {
+      strcpy_P(p, label);
+      p += strlen_P(label);
+      p = status_snapshot.append_float(p, c, tenths);
+      strcpy_P(p, PSTR(" /"));
+      p = status_snapshot.append_float(p + 2, t, tenths);
+    };
+    const float c0 = thermalManager.temp_hotend[0].celsius, t0 = thermalManager.temp_hotend[0].target;
+    add(PSTR("T:"), c0, t0);
+    add(PSTR(" B:"), TERN0(HAS_HEATED_BED, thermalManager.temp_bed.celsius), TERN0(HAS_HEATED_BED, thermalManager.temp_bed.target));
+    add(PSTR(" T0:"), c0, t0);
+    #if DISABLED(SINGLENOZZLE) && HAS_MULTI_EXTRUDER
+      add(PSTR(" T1:"), thermalManager.temp_hotend[1].celsius, thermalManager.temp_hotend[1].target);
+    #else
+      add(PSTR(" T1:"), 0, 0);
+    #endif
+    strcpy_P(p, PSTR(" @:0 B@:0\r\n"));
+    return text[tenths];
+  }
+
+#endif
+
 static void wifi_gcode_exec(uint8_t *cmd_line) {
   int8_t tempBuf[100] = { 0 };
   uint8_t *tmpStr = 0;
@@ -1238,6 +1523,13 @@ static void wifi_gcode_exec(uint8_t *cmd_line) {
           break;
         case 105:
         case 991:
+          #if ENABLED(STATUS_SNAPSHOT)
+          {
+            if (cmd_value == 105) SEND_OK_TO_WIFI;
+            const char * const temps = wifi_temps(cmd_value == 105);
+            send_to_wifi((uint8_t *)temps, strlen(temps));
+          }
+          #else
           ZERO(tempBuf);
           if (cmd_value == 105) {
             SEND_OK_TO_WIFI;
@@ -1276,6 +1568,7 @@ static void wifi_gcode_exec(uint8_t *cmd_line) {
           }
 
           send_to_wifi((uint8_t *)tempBuf, strlen((char *)tempBuf));
+          #endif
           queue.enqueue_one_P(PSTR("M105"));
           break;
 
@@ -1333,6 +1626,9 @@ static void wifi_gcode_exec(uint8_t *cmd_line) {
           ZERO(tempBuf);
           SEND_OK_TO_WIFI;
           send_to_wifi((uint8_t *)"FIRMWARE_NAME:Robin_nano\r\n", strlen("FIRMWARE_NAME:Robin_nano\r\n"));
+          #if ENABLED(MKS_WIFI_MEATPACK)
+            send_to_wifi((uint8_t *)"Cap:MEATPACK:1\r\n", strlen("Cap:MEATPACK:1\r\n"));
+          #endif
           break;
 
         default:
@@ -1535,12 +1831,56 @@ static void wifi_list_msg_handle(uint8_t * msg, uint16_t msgLen) {
   }
 }
 
+#if ENABLED(MKS_WIFI_MEATPACK)
+
+  // The WiFi stream has its own MeatPack state, and its replies go back to the ESP
+  static MeatPack wifi_meatpack;
+  static void wifi_meatpack_reply(const char * const msg) { send_to_wifi((uint8_t *)msg, strlen(msg)); }
+
+  /**
+   * Unpack a G-code frame and run its lines, which may be split between
+   * frames once packed. Plain G-code passes through unchanged until the
+   * host turns packing on with the MeatPack command bytes.
+   */
+  static void gcode_msg_unpack(const uint8_t * const msg, const uint16_t msgLen) {
+    static uint8_t gcodeBuf[100];
+    static uint8_t len; // = 0
+    static bool too_long; // = false
+
+    LOOP_L_N(i, msgLen) {
+      wifi_meatpack.handle_rx_char(msg[i], 0);
+      char out[2];
+      const uint8_t count = wifi_meatpack.get_result_char(out);
+      LOOP_L_N(o, count) {
+        const char c = out[o];
+        if (len < sizeof(gcodeBuf) - 2) gcodeBuf[len++] = c; else too_long = true;
+        if (c != '\n') continue;
+
+        gcodeBuf[len] = '\0';
+        char *cmd = (char *)gcodeBuf;
+        if (*cmd == 'N') {                      // Drop the line number
+          cmd = strchr(cmd, ' ');
+          if (cmd) while (*cmd == ' ') cmd++;
+        }
+        if (cmd && !too_long) wifi_gcode_exec((uint8_t *)cmd);
+        len = 0;
+        too_long = false;
+      }
+    }
+  }
+
+#endif
+
 static void gcode_msg_handle(uint8_t * msg, uint16_t msgLen) {
   uint8_t gcodeBuf[100] = { 0 };
   char *index_s, *index_e;
 
   if (msgLen <= 0) return;
 
+  #if ENABLED(MKS_WIFI_MEATPACK)
+    return gcode_msg_unpack(msg, msgLen);
+  #endif
+
   index_s = (char *)msg;
   index_e = (char *)strchr((char *)msg, '\n');
   if (*msg == 'N') {
@@ -1636,6 +1976,7 @@ static void file_first_msg_handle(uint8_t * msg, uint16_t msgLen) {
   }
   file_writer.write_index = 0;
   lastFragment = -1;
+  TERN_(MKS_WIFI_COMPRESSED_UPLOAD, upload_unpack_reset());
 
   wifiTransError.flag = 0;
   wifiTransError.start_tick = 0;
@@ -1701,7 +2042,9 @@ static void file_fragment_msg_handle(uint8_t * msg, uint16_t msgLen) {
     upload_result = 2;
   }
   else {
-    if (write_to_file((char *)msg + 4, msgLen - 4) < 0) {
+    if (TERN(MKS_WIFI_COMPRESSED_UPLOAD, upload_write, write_to_file)((char *)msg + 4, msgLen - 4) < 0
+      || (TERN0(MKS_WIFI_COMPRESSED_UPLOAD, (frag & (~FRAG_MASK)) != 0 && upload_finish() < 0))
+    ) {
       ZERO(public_buf);
       file_writer.write_index = 0;
       wifi_link_state = WIFI_CONNECTED;
@@ -1894,6 +2237,7 @@ void stopEspTransfer() {
   #ifdef __STM32F1__
     dma_clear_isr_bits(DMA1, DMA_CH5);
     bb_peri_set_bit(&USART1_BASE->CR3, USART_CR3_DMAR_BIT, 0);
+    TERN_(MKS_WIFI_DMA_RX, USART1_BASE->CR1 &= ~USART_CR1_IDLEIE);
     dma_disable(DMA1, DMA_CH5);
   #else
     // First, abort any running dma
@@ -1937,6 +2281,16 @@ void wifi_rcv_handle() {
           len++;
         }
       }
+    #elif ENABLED(MKS_WIFI_DMA_RX)
+      len = rx_ring_read(ucStr, UART_RX_BUFFER_SIZE);
+      if (len < 0) {
+        wifi_link_state = WIFI_CONNECTED;
+        upload_result = 2;
+        lv_clear_cur_ui();
+        stopEspTransfer();
+        lv_draw_dialog(DIALOG_TYPE_UPLOAD_FILE);
+        return;
+      }
     #else
       #ifndef __STM32F1__
         if (wifiDmaRcvFifo.receiveEspData) storeRcvData(WIFISERIAL.wifiRxBuf, UART_RX_BUFFER_SIZE);
@@ -1952,7 +2306,7 @@ void wifi_rcv_handle() {
       }
       getDataF = 1;
     }
-    #ifdef __STM32F1__
+    #if defined(__STM32F1__) && DISABLED(MKS_WIFI_DMA_RX)
       if (esp_state == TRANSFER_STORE) {
         if (storeRcvData(WIFISERIAL.wifiRxBuf, UART_RX_BUFFER_SIZE)) {
           esp_state = TRANSFERING;
@@ -2053,6 +2407,8 @@ void mks_esp_wifi_init() {
   esp_state = TRANSFER_IDLE;
   esp_port_begin(1);
 
+  TERN_(MKS_WIFI_MEATPACK, wifi_meatpack.reply = wifi_meatpack_reply);
+
   wifi_reset();
 
   #if 0
@@ -61,7 +61,7 @@ typedef enum{
   udisk_buf_full,
 } UDISK_DATA_BUFFER_STATE;
 
-#define TRANS_RCV_FIFO_BLOCK_NUM  14
+#define TRANS_RCV_FIFO_BLOCK_NUM  10 // Blocks of bmp_public_buf
 
 typedef struct {
   bool receiveEspData;
@@ -195,6 +195,10 @@ extern void mks_wifi_firmware_upddate();
 extern int usartFifoAvailable(SZ_USART_FIFO *fifo);
 extern int readUsartFifo(SZ_USART_FIFO *fifo, int8_t *buf, int32_t len);
 extern void esp_port_begin(uint8_t interrupt);
+#if ENABLED(MKS_WIFI_DMA_RX)
+  extern void wifi_rx_idle_irq();
+  extern void wifi_rx_report();
+#endif
 
 #ifdef __cplusplus
   } /* C-declarations for C++ */
@@ -36,6 +36,10 @@
   #include "../../module/probe.h"
 #endif
 
+#if ENABLED(BILINEAR_MESH_TEMP_BLEND)
+  #include "../../feature/bedlevel/abl/mesh_store.h"
+#endif
+
 #if HAS_GRAPHICAL_TFT
   #include "../tft/tft.h"
   #if ENABLED(TOUCH_SCREEN)
@@ -206,6 +210,8 @@
 #if ENABLED(MESH_EDIT_MENU)
 
   inline void refresh_planner() {
+    TERN_(BILINEAR_MESH_TEMP_BLEND, mesh_store.blend_stop());
+    TERN_(AUTO_BED_LEVELING_BILINEAR, refresh_bed_level());
     set_current_from_steppers_for_axis(ALL_AXES);
     sync_plan_position();
   }
@@ -34,15 +34,28 @@ uint8_t *TFT_Queue::current_task = nullptr;
 uint8_t *TFT_Queue::last_task = nullptr;
 uint8_t *TFT_Queue::last_parameter = nullptr;
 
-void TFT_Queue::reset() {
-  tft.abort();
-
+#if ENABLED(TFT_DAMAGE_TRACKING)
+  damageSlot_t TFT_Queue::damage[TFT_DAMAGE_SLOTS];
+  uint8_t TFT_Queue::damage_victim;
+  uint32_t TFT_Queue::sketch_signature;
+  uint32_t TFT_Queue::drawn_pixels, TFT_Queue::drawn_tasks, TFT_Queue::skipped_tasks;
+  millis_t TFT_Queue::stats_since;
+#endif
+
+void TFT_Queue::rewind() {
   end_of_queue = queue;
   current_task = nullptr;
   last_task = nullptr;
   last_parameter = nullptr;
 }
 
+void TFT_Queue::reset() {
+  tft.abort();
+  rewind();
+  // Whatever was pending is only partly on the screen
+  TERN_(TFT_DAMAGE_TRACKING, invalidate(0, 0, TFT_WIDTH, TFT_HEIGHT));
+}
+
 void TFT_Queue::async() {
   if (!current_task) return;
   queueTask_t *task = (queueTask_t *)current_task;
@@ -58,7 +71,7 @@ void TFT_Queue::async() {
   finish_sketch();
 
   switch (task->type) {
-    case TASK_END_OF_QUEUE: reset();      break;
+    case TASK_END_OF_QUEUE: rewind();     break;
     case TASK_FILL:         fill(task);   break;
     case TASK_CANVAS:       canvas(task); break;
   }
@@ -69,6 +82,16 @@ void TFT_Queue::finish_sketch() {
   queueTask_t *task = (queueTask_t *)last_task;
 
   if (task->state == TASK_STATE_SKETCH) {
+    #if ENABLED(TFT_DAMAGE_TRACKING)
+      // The screen already shows this canvas, so drop it from the queue
+      if (!damaged((parametersCanvas_t *)(last_task + sizeof(queueTask_t)))) {
+        end_of_queue = last_task;
+        *end_of_queue = TASK_END_OF_QUEUE;
+        if (current_task == last_task) current_task = nullptr;
+        last_task = nullptr;
+        return;
+      }
+    #endif
     *end_of_queue = TASK_END_OF_QUEUE;
     task->nextTask = end_of_queue;
     task->state = TASK_STATE_READY;
@@ -160,6 +183,12 @@ void TFT_Queue::fill(uint16_t x, uint16_t y, uint16_t width, uint16_t height, ui
   task_parameters->color = ENDIAN_COLOR(color);
   task_parameters->count = width * height;
 
+  #if ENABLED(TFT_DAMAGE_TRACKING)
+    invalidate(x, y, width, height);
+    drawn_tasks++;
+    drawn_pixels += task_parameters->count;
+  #endif
+
   *end_of_queue = TASK_END_OF_QUEUE;
   task->nextTask = end_of_queue;
   task->state = TASK_STATE_READY;
@@ -189,6 +218,8 @@ void TFT_Queue::canvas(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
   task_parameters->height = height;
   task_parameters->count = 0;
 
+  TERN_(TFT_DAMAGE_TRACKING, sketch_signature = 2166136261UL);
+
   if (!current_task) current_task = (uint8_t *)task;
 }
 
@@ -204,8 +235,58 @@ void TFT_Queue::set_background(uint16_t color) {
   end_of_queue += sizeof(parametersCanvasBackground_t);
   task_parameters->count++;
   parameters->nextParameter = end_of_queue;
+  TERN_(TFT_DAMAGE_TRACKING, sign((uint8_t *)parameters));
 }
 
+#if ENABLED(TFT_DAMAGE_TRACKING)
+
+  /**
+   * Damage tracking: each canvas is a widget, signed with all it draws
+   * (FNV-1a of its parameters, less the queue pointers). A canvas with
+   * the same place and signature as the one last sent there is already
+   * on the screen and is skipped. Fills and changed canvases mark what
+   * they cover as drawn over.
+   */
+  void TFT_Queue::sign(uint8_t *parameter) {
+    const uint8_t *p = parameter + sizeof(CanvasSubtype) + sizeof(uint8_t *);
+    sketch_signature = (sketch_signature ^ *parameter) * 16777619UL;
+    while (p < end_of_queue) sketch_signature = (sketch_signature ^ *p++) * 16777619UL;
+  }
+
+  void TFT_Queue::invalidate(uint16_t x, uint16_t y, uint16_t width, uint16_t height) {
+    for (auto &d : damage)
+      if (d.width && d.x < x + width && x < d.x + d.width && d.y < y + height && y < d.y + d.height)
+        d.width = 0;
+  }
+
+  bool TFT_Queue::damaged(parametersCanvas_t *canvas) {
+    damageSlot_t *slot = nullptr;
+    for (auto &d : damage) {
+      if (d.x == canvas->x && d.y == canvas->y && d.width == canvas->width && d.height == canvas->height) {
+        if (d.signature == sketch_signature) { skipped_tasks++; return false; }
+        slot = &d;
+        break;
+      }
+    }
+    invalidate(canvas->x, canvas->y, canvas->width, canvas->height);
+    if (!slot)
+      for (auto &d : damage) if (!d.width) { slot = &d; break; }
+    if (!slot) slot = &damage[damage_victim++ % TFT_DAMAGE_SLOTS];
+    *slot = { canvas->x, canvas->y, canvas->width, canvas->height, sketch_signature };
+    drawn_tasks++;
+    drawn_pixels += uint32_t(canvas->width) * canvas->height;
+    return true;
+  }
+
+  void TFT_Queue::report() {
+    const millis_t ms = millis(), span = _MAX(ms - stats_since, 1UL);
+    SERIAL_ECHOLNPAIR("TFT redraw:", drawn_pixels * 1000UL / span, " px/s drawn:", drawn_tasks, " skipped:", skipped_tasks, " in ", span, "ms");
+    drawn_pixels = drawn_tasks = skipped_tasks = 0;
+    stats_since = ms;
+  }
+
+#endif // TFT_DAMAGE_TRACKING
+
 #define QUEUE_SAFETY_FREE_SPACE 100
 
 void TFT_Queue::handle_queue_overflow(uint16_t sizeNeeded) {
@@ -238,6 +319,7 @@ void TFT_Queue::add_text(uint16_t x, uint16_t y, uint16_t color, uint8_t *string
   parameters->nextParameter = end_of_queue;
   parameters->stringLength = pointer - string;
   task_parameters->count++;
+  TERN_(TFT_DAMAGE_TRACKING, sign((uint8_t *)parameters));
 }
 
 void TFT_Queue::add_image(int16_t x, int16_t y, MarlinImage image, uint16_t *colors) {
@@ -257,7 +339,10 @@ void TFT_Queue::add_image(int16_t x, int16_t y, MarlinImage image, uint16_t *col
 
   colorMode_t color_mode = Images[image].colorMode;
 
-  if (color_mode == HIGHCOLOR) return;
+  if (color_mode == HIGHCOLOR) {
+    TERN_(TFT_DAMAGE_TRACKING, sign((uint8_t *)parameters));
+    return;
+  }
 
   uint16_t *color = (uint16_t *)end_of_queue;
   uint8_t color_count = 0;
@@ -277,6 +362,7 @@ void TFT_Queue::add_image(int16_t x, int16_t y, MarlinImage image, uint16_t *col
 
   end_of_queue = (uint8_t *)color;
   parameters->nextParameter = end_of_queue;
+  TERN_(TFT_DAMAGE_TRACKING, sign((uint8_t *)parameters));
 }
 
 uint16_t gradient(uint16_t colorA, uint16_t colorB, uint16_t factor) {
@@ -331,6 +417,7 @@ void TFT_Queue::add_bar(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
   end_of_queue += sizeof(parametersCanvasBar_t);
   task_parameters->count++;
   parameters->nextParameter = end_of_queue;
+  TERN_(TFT_DAMAGE_TRACKING, sign((uint8_t *)parameters));
 }
 
 void TFT_Queue::add_rectangle(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color) {
@@ -349,6 +436,7 @@ void TFT_Queue::add_rectangle(uint16_t x, uint16_t y, uint16_t width, uint16_t h
   end_of_queue += sizeof(parametersCanvasRectangle_t);
   task_parameters->count++;
   parameters->nextParameter = end_of_queue;
+  TERN_(TFT_DAMAGE_TRACKING, sign((uint8_t *)parameters));
 }
 
 #endif // HAS_GRAPHICAL_TFT
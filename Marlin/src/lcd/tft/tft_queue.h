@@ -118,6 +118,21 @@ typedef struct __attribute__((__packed__)) {
   uint16_t color;
 } parametersCanvasRectangle_t;
 
+#if ENABLED(TFT_DAMAGE_TRACKING)
+  #ifndef TFT_DAMAGE_SLOTS
+    #define TFT_DAMAGE_SLOTS 32
+  #endif
+
+  // A canvas as last sent to the screen
+  typedef struct {
+    uint16_t x;
+    uint16_t y;
+    uint16_t width;             // 0 = unused, or drawn over since
+    uint16_t height;
+    uint32_t signature;
+  } damageSlot_t;
+#endif
+
 class TFT_Queue {
   private:
     static uint8_t queue[TFT_QUEUE_SIZE];
@@ -126,13 +141,27 @@ class TFT_Queue {
     static uint8_t *last_task;
     static uint8_t *last_parameter;
 
+    static void rewind();
     static void finish_sketch();
     static void fill(queueTask_t *task);
     static void canvas(queueTask_t *task);
     static void handle_queue_overflow(uint16_t sizeNeeded);
 
+    #if ENABLED(TFT_DAMAGE_TRACKING)
+      static damageSlot_t damage[TFT_DAMAGE_SLOTS];
+      static uint8_t damage_victim;
+      static uint32_t sketch_signature;
+      static uint32_t drawn_pixels, drawn_tasks, skipped_tasks;
+      static millis_t stats_since;
+
+      static void sign(uint8_t *parameter);
+      static bool damaged(parametersCanvas_t *canvas);
+      static void invalidate(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+    #endif
+
   public:
     static void reset();
+    TERN_(TFT_DAMAGE_TRACKING, static void report());
     static void async();
     static void sync() { while (current_task != NULL) async(); }
 
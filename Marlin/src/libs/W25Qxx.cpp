@@ -52,6 +52,7 @@ MarlinSPI W25QXXFlash::mySPI(SPI_FLASH_MOSI_PIN, SPI_FLASH_MISO_PIN, SPI_FLASH_S
 bool flash_dma_mode = true;
 
 void W25QXXFlash::init(uint8_t spiRate) {
+  SPI_FLASH_ReadWait();
 
   OUT_WRITE(SPI_FLASH_CS_PIN, HIGH);
 
@@ -133,6 +134,7 @@ void W25QXXFlash::spi_flash_SendBlock(uint8_t token, const uint8_t* buf) {
 }
 
 uint16_t W25QXXFlash::W25QXX_ReadID(void) {
+  SPI_FLASH_ReadWait();
   uint16_t Temp = 0;
   W25QXX_CS_L;
   spi_flash_Send(0x90);
@@ -146,6 +148,7 @@ uint16_t W25QXXFlash::W25QXX_ReadID(void) {
 }
 
 void W25QXXFlash::SPI_FLASH_WriteEnable(void) {
+  SPI_FLASH_ReadWait();
   // Select the FLASH: Chip Select low
   W25QXX_CS_L;
   // Send "Write Enable" instruction
@@ -365,6 +368,8 @@ void W25QXXFlash::SPI_FLASH_BufferWrite(uint8_t* pBuffer, uint32_t WriteAddr, ui
 * Return         : None
 *******************************************************************************/
 void W25QXXFlash::SPI_FLASH_BufferRead(uint8_t* pBuffer, uint32_t ReadAddr, uint16_t NumByteToRead) {
+  SPI_FLASH_ReadWait();
+
   // Select the FLASH: Chip Select low
   W25QXX_CS_L;
 
@@ -392,4 +397,44 @@ void W25QXXFlash::SPI_FLASH_BufferRead(uint8_t* pBuffer, uint32_t ReadAddr, uint
   W25QXX_CS_H;
 }
 
+#ifdef __STM32F1__
+
+  static bool flash_read_pending; // = false
+  static volatile bool flash_read_busy; // = false
+
+  // DMA complete, from the SPI interrupt
+  static void flash_read_done() {
+    W25QXX_CS_H;
+    flash_read_busy = false;
+  }
+
+  /**
+   * Like SPI_FLASH_BufferRead, but return as soon as DMA takes over.
+   * The buffer is only valid after SPI_FLASH_ReadWait(), which every
+   * other flash access calls first.
+   */
+  void W25QXXFlash::SPI_FLASH_BufferReadAsync(uint8_t* pBuffer, uint32_t ReadAddr, uint16_t NumByteToRead) {
+    if (NumByteToRead <= 32 || !flash_dma_mode) return SPI_FLASH_BufferRead(pBuffer, ReadAddr, NumByteToRead);
+
+    SPI_FLASH_ReadWait();
+    W25QXX_CS_L;
+    spi_flash_Send(W25X_ReadData);
+    spi_flash_Send((ReadAddr & 0xFF0000) >> 16);
+    spi_flash_Send((ReadAddr & 0xFF00) >> 8);
+    spi_flash_Send(ReadAddr & 0xFF);
+
+    flash_read_pending = flash_read_busy = true;
+    mySPI.onReceive(flash_read_done);
+    mySPI.dmaTransfer(0, pBuffer, NumByteToRead);
+  }
+
+  void W25QXXFlash::SPI_FLASH_ReadWait() {
+    if (!flash_read_pending) return;
+    while (flash_read_busy) { /* nada */ }
+    mySPI.onReceive(nullptr);   // Back to blocking transfers
+    flash_read_pending = false;
+  }
+
+#endif
+
 #endif // HAS_SPI_FLASH
@@ -69,6 +69,13 @@ public:
   static void SPI_FLASH_PageWrite(uint8_t* pBuffer, uint32_t WriteAddr, uint16_t NumByteToWrite);
   static void SPI_FLASH_BufferWrite(uint8_t* pBuffer, uint32_t WriteAddr, uint16_t NumByteToWrite);
   static void SPI_FLASH_BufferRead(uint8_t* pBuffer, uint32_t ReadAddr, uint16_t NumByteToRead);
+  #ifdef __STM32F1__
+    static void SPI_FLASH_BufferReadAsync(uint8_t* pBuffer, uint32_t ReadAddr, uint16_t NumByteToRead);
+    static void SPI_FLASH_ReadWait();
+  #else
+    static void SPI_FLASH_BufferReadAsync(uint8_t* pBuffer, uint32_t ReadAddr, uint16_t NumByteToRead) { SPI_FLASH_BufferRead(pBuffer, ReadAddr, NumByteToRead); }
+    static void SPI_FLASH_ReadWait() {}
+  #endif
 };
 
 extern W25QXXFlash W25QXX;
@@ -819,7 +819,7 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
 
 #else // !IS_KINEMATIC
 
-  #if ENABLED(SEGMENT_LEVELED_MOVES)
+  #if ENABLED(SEGMENT_LEVELED_MOVES) && !HAS_ADAPTIVE_LEVELED_SEGMENTS
 
     /**
      * Prepare a segmented move on a CARTESIAN setup.
@@ -887,7 +887,7 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
       );
     }
 
-  #endif // SEGMENT_LEVELED_MOVES
+  #endif // SEGMENT_LEVELED_MOVES && !HAS_ADAPTIVE_LEVELED_SEGMENTS
 
   /**
    * Prepare a linear move in a Cartesian setup.
@@ -904,12 +904,13 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
         #if ENABLED(AUTO_BED_LEVELING_UBL)
           ubl.line_to_destination_cartesian(scaled_fr_mm_s, active_extruder); // UBL's motion routine needs to know about
           return true;                                                        // all moves, including Z-only moves.
-        #elif ENABLED(SEGMENT_LEVELED_MOVES)
+        #elif ENABLED(SEGMENT_LEVELED_MOVES) && !HAS_ADAPTIVE_LEVELED_SEGMENTS
           segmented_line_to_destination(scaled_fr_mm_s);
           return false; // caller will update current_position
         #else
           /**
            * For MBL and ABL-BILINEAR only segment moves when X or Y are involved.
+           * With HAS_ADAPTIVE_LEVELED_SEGMENTS bilinear also subdivides curved cells.
            * Otherwise fall through to do a direct single move.
            */
           if (xy_pos_t(current_position) != xy_pos_t(destination)) {
@@ -108,6 +108,10 @@
   #include "../feature/power_monitor.h"
 #endif
 
+#if ENABLED(STATUS_SNAPSHOT)
+  #include "../feature/status_snapshot.h"
+#endif
+
 #if ENABLED(EMERGENCY_PARSER)
   #include "../feature/e_parser.h"
 #endif
@@ -3126,7 +3130,11 @@ void Temperature::tick() {
   #if ENABLED(AUTO_REPORT_TEMPERATURES)
     AutoReporter<Temperature::AutoReportTemp> Temperature::auto_reporter;
     void Temperature::AutoReportTemp::report() {
-      print_heater_states(active_extruder);
+      #if ENABLED(STATUS_SNAPSHOT)
+        SERIAL_ECHO(status_snapshot.heaters());
+      #else
+        print_heater_states(active_extruder);
+      #endif
       SERIAL_EOL();
     }
   #endif
@@ -1260,6 +1260,30 @@ void CardReader::fileHasFinished() {
     }
   }
 
+  #if ENABLED(POWER_LOSS_JOURNAL)
+
+    /**
+     * Get the first block of the job recovery file if it is a contiguous file of at least
+     * the given size. With 'create' replace it with one if it isn't.
+     */
+    bool CardReader::jobRecoveryJournal(uint32_t &firstBlock, const uint32_t size, const bool create) {
+      if (!isMounted()) return false;
+      SdFile &f = recovery.file;
+      uint32_t lastBlock;
+      if (f.isOpen()) f.close();
+      if (f.open(&root, recovery.filename, create ? O_RDWR : O_READ)) {
+        const bool ok = f.fileSize() >= size && f.contiguousRange(&firstBlock, &lastBlock);
+        if (ok || !create) { f.close(); return ok; }
+        f.remove();   // Scattered or too small, like a file from before the journal
+      }
+      if (!create) return false;
+      const bool ok = f.createContiguous(&root, recovery.filename, size) && f.contiguousRange(&firstBlock, &lastBlock);
+      f.close();
+      return ok;
+    }
+
+  #endif
+
 #endif // POWER_LOSS_RECOVERY
 
 #endif // SDSUPPORT
@@ -161,6 +161,9 @@ public:
     static bool jobRecoverFileExists();
     static void openJobRecoveryFile(const bool read);
     static void removeJobRecoveryFile();
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      static bool jobRecoveryJournal(uint32_t &firstBlock, const uint32_t size, const bool create);
+    #endif
   #endif
 
   static inline bool isFileOpen() { return isMounted() && file.isOpen(); }
@@ -0,0 +1,276 @@
+#!/usr/bin/env python3
+"""
+Run binary_upload.py against the firmware side of the binary file transfer
+(BINARY_FILE_TRANSFER) on the host, and compare the transfer with and without
+BINARY_STREAM_WINDOW.
+
+binary_stream.h, binary_stream.cpp, the heatshrink decoder and core/macros.h
+are built as they are, with a stand-in for the SD card that writes to a file
+and a serial port that is a pseudo terminal. binary_upload.py opens the pty as
+it would the printer, the uploaded file must come out byte for byte, and both
+builds are timed on the same file.
+
+A pty has no line rate and no delay, so the stand-in paces the bytes coming in
+to --baud and holds each reply for --latency ms, as a USB serial adapter does.
+With --loss about that percentage of the packets arrive with a damaged byte
+and of the "ok" replies get lost, so that resends are exercised too. A lost
+reply or a damaged packet token costs the one second timeout of the script.
+
+The rates are those of the model line, not of a printer: SD writes take no
+time here.
+
+Builds with $CXX, or c++. Needs pyserial (pip install pyserial).
+
+  binary_stream_test.py
+  binary_stream_test.py --size 64 --loss 10 --latency 5
+"""
+
+import argparse
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+MARLIN = os.path.join(HERE, '..', '..', '..', 'Marlin')
+SRC = os.path.join(MARLIN, 'src')
+
+CONFIG_PRE = r'''
+#pragma once
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include "../core/macros.h"
+#include "../core/millis_t.h"
+
+#define BINARY_FILE_TRANSFER
+#define NUM_SERIAL 1
+%(window)s
+'''
+
+CONFIG = r'''
+#pragma once
+#include "MarlinConfigPre.h"
+
+millis_t millis();
+
+// The serial port, a pty paced as a serial line
+struct HostSerial {
+  bool available(const uint8_t);
+  int read(const uint8_t);
+  void print(const char *s) { line += s; }
+  template<typename T> void print(const T v) { line += std::to_string((long)v); }
+  void println();
+  std::string line;
+};
+extern HostSerial host_serial;
+#define SERIAL_IMPL host_serial
+
+inline void serial_print_all() {}
+template<typename T, typename... Args> void serial_print_all(const T v, Args... args) { host_serial.print(v); serial_print_all(args...); }
+
+#define SERIAL_ECHO_START()         host_serial.print("echo:")
+#define SERIAL_ECHOLNPGM(S)         do{ host_serial.print(S); host_serial.println(); }while(0)
+#define SERIAL_ECHO_MSG(S)          do{ SERIAL_ECHO_START(); SERIAL_ECHOLNPGM(S); }while(0)
+#define SERIAL_ECHOPAIR(V...)       serial_print_all(V)
+#define SERIAL_ECHOLNPAIR(V...)     do{ serial_print_all(V); host_serial.println(); }while(0)
+'''
+
+CARDREADER = r'''
+#pragma once
+#include "../inc/MarlinConfig.h"
+#include <stdio.h>
+
+// Stands in for the SD card, the file goes to the path given to the test
+class CardReader {
+public:
+  struct { bool binary_mode; } flag;
+  uint8_t transfer_port_index;
+  char filename[13];
+  const char *path;
+  FILE *file;
+
+  void mount() {}
+  void release() {}
+  void openFileWrite(const char *name) { strncpy(filename, name, 12); file = fopen(path, "wb"); }
+  bool isFileOpen() { return file != nullptr; }
+  int16_t write(void *buf, const uint16_t nbyte) { return fwrite(buf, 1, nbyte, file) == nbyte ? nbyte : -1; }
+  void closefile() { if (file) fclose(file); file = nullptr; }
+  void removeFile(const char *) { remove(path); }
+};
+
+extern CardReader card;
+'''
+
+HARNESS = r'''
+#define _XOPEN_SOURCE 600
+#include <chrono>
+#include <deque>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "inc/MarlinConfig.h"
+#include "sd/cardreader.h"
+#include "feature/binary_stream.h"
+
+CardReader card;
+HostSerial host_serial;
+
+static int pty;
+static double byte_time, latency, loss;
+static bool hung_up, synced;
+
+static double now() {
+  static const auto start = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+millis_t millis() { return millis_t(now() * 1000); }
+
+static bool chance(const double p) { return rand() < p * RAND_MAX; }
+
+struct Timed { double due; std::string data; };
+static std::deque<Timed> in, out;
+static double in_due;
+
+// Move bytes between the pty and the paced queues
+static void pump() {
+  char buf[256];
+  const ssize_t n = ::read(pty, buf, sizeof(buf));
+  if (n < 0 && errno == EIO) hung_up = true;
+  for (ssize_t i = 0; i < n; i++) {
+    in_due = (in_due > now() ? in_due : now()) + byte_time;
+    if (synced && chance(loss)) buf[i] ^= 0x5A;
+    in.push_back({ in_due, std::string(1, buf[i]) });
+  }
+  while (!out.empty() && out.front().due <= now()) {
+    if (::write(pty, out.front().data.data(), out.front().data.size()) < 0) hung_up = true;
+    out.pop_front();
+  }
+}
+
+bool HostSerial::available(const uint8_t) { pump(); return !in.empty() && in.front().due <= now(); }
+int HostSerial::read(const uint8_t) { const int c = (uint8_t)in.front().data[0]; in.pop_front(); return c; }
+
+void HostSerial::println() {
+  const bool ok = line.compare(0, 2, "ok") == 0;
+  if (line.compare(0, 2, "ss") == 0) synced = true;  // The sync reply isn't asked for again, so damage comes after it
+  if (!(ok && chance(loss * %(packet)s))) out.push_back({ now() + latency, line + "\n" });
+  line.clear();
+}
+
+int main(int argc, char **argv) {
+  card.path = argv[1];
+  byte_time = 10.0 / atof(argv[2]);
+  latency = atof(argv[3]) / 1000;
+  loss = atof(argv[4]) / 100 / %(packet)s;
+  srand(atoi(argv[5]));
+
+  pty = posix_openpt(O_RDWR | O_NOCTTY);
+  if (pty < 0 || grantpt(pty) || unlockpt(pty)) { perror("pty"); return 1; }
+  // Raw from the start, so nothing is echoed back before the port is opened
+  const int slave = open(ptsname(pty), O_RDWR | O_NOCTTY);
+  termios t;
+  tcgetattr(slave, &t);
+  cfmakeraw(&t);
+  tcsetattr(slave, TCSANOW, &t);
+  fcntl(pty, F_SETFL, O_NONBLOCK);
+  printf("%%s\n", ptsname(pty));
+  fflush(stdout);
+
+  // Wait for 'M28 B1', as the firmware would in ASCII mode
+  std::string command;
+  while (command.find("M28 B1") == std::string::npos) {
+    if (host_serial.available(0)) command += char(host_serial.read(0));
+    else usleep(1000);
+  }
+  close(slave);
+  hung_up = false;
+  card.flag.binary_mode = true;
+  binaryStream[0].stream_state = BinaryStream::StreamState::PACKET_RESET;
+
+  // Keep answering until the script closes the port, for a CLOSE sent again
+  static char serial_line_buffer[MAX_CMD_SIZE];
+  while (!hung_up || !out.empty()) {
+    binaryStream[0].receive(serial_line_buffer);
+    if (!host_serial.available(0)) usleep(100);
+  }
+  return card.flag.binary_mode;
+}
+'''
+
+def define(name):
+  with open(os.path.join(MARLIN, 'Configuration_adv.h')) as f:
+    m = re.search(r'^\s*(?://)?#define\s+%s\s+(\d+)' % name, f.read(), re.M)
+  if not m: sys.exit("%s not found in Configuration_adv.h" % name)
+  return int(m.group(1))
+
+parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+parser.add_argument('--size', type=int, default=32, help='KB of data to upload (default 32)')
+parser.add_argument('--baud', type=int, default=115200, help='Line rate to model (default 115200)')
+parser.add_argument('--latency', type=float, default=2, help='Reply delay to model, in ms (default 2)')
+parser.add_argument('--loss', type=float, default=0, help='Percentage of damaged packets and lost acks (default 0)')
+parser.add_argument('--seed', type=int, default=1, help='Random seed (default 1)')
+args = parser.parse_args()
+
+window, packet_size, cmd_size = define('BINARY_STREAM_WINDOW'), define('BINARY_STREAM_PACKET_SIZE'), define('MAX_CMD_SIZE')
+builds = [
+  ('without BINARY_STREAM_WINDOW', '#define MAX_CMD_SIZE %d' % cmd_size, cmd_size),
+  ('with BINARY_STREAM_WINDOW %d' % window,
+   '#define MAX_CMD_SIZE %d\n#define BINARY_STREAM_WINDOW %d\n#define BINARY_STREAM_PACKET_SIZE %d\n#define HAS_BINARY_STREAM_WINDOW 1'
+   % (cmd_size, window, packet_size), packet_size),
+]
+
+failed = False
+with tempfile.TemporaryDirectory() as tmp:
+  data = os.urandom(args.size * 1024)
+  upload = os.path.join(tmp, 'upload.gcode')
+  with open(upload, 'wb') as f: f.write(data)
+
+  for name, config, size in builds:
+    tree = os.path.join(tmp, 'src')
+    shutil.rmtree(tree, ignore_errors=True)
+    for sub in ('core', 'feature', 'libs/heatshrink', 'inc', 'sd'):
+      os.makedirs(os.path.join(tree, sub))
+    for part in ('core/macros.h', 'core/millis_t.h', 'feature/binary_stream.h', 'feature/binary_stream.cpp',
+                 'libs/heatshrink/heatshrink_common.h', 'libs/heatshrink/heatshrink_config.h',
+                 'libs/heatshrink/heatshrink_decoder.h', 'libs/heatshrink/heatshrink_decoder.cpp'):
+      shutil.copy(os.path.join(SRC, part), os.path.join(tree, part))
+    for part, text in (('inc/MarlinConfigPre.h', CONFIG_PRE % { 'window': config }), ('inc/MarlinConfig.h', CONFIG),
+                       ('sd/cardreader.h', CARDREADER), ('main.cpp', HARNESS % { 'packet': size + 10 })):
+      with open(os.path.join(tree, part), 'w') as f: f.write(text)
+
+    exe = os.path.join(tmp, 'binary_stream_test')
+    subprocess.check_call([os.environ.get('CXX', 'c++'), '-O2', '-std=gnu++14', '-w', '-o', exe,
+                           os.path.join(tree, 'main.cpp'), os.path.join(tree, 'feature', 'binary_stream.cpp'),
+                           os.path.join(tree, 'libs', 'heatshrink', 'heatshrink_decoder.cpp')])
+
+    received = os.path.join(tmp, 'UPLOAD.GCO')
+    if os.path.exists(received): os.remove(received)
+    firmware = subprocess.Popen([exe, received, str(args.baud), str(args.latency), str(args.loss), str(args.seed)],
+                                stdout=subprocess.PIPE, universal_newlines=True)
+    port = firmware.stdout.readline().strip()
+    try:
+      result = subprocess.run([sys.executable, os.path.join(HERE, 'binary_upload.py'), port, upload, 'UPLOAD.GCO',
+                               '--baud', str(args.baud)], stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                               universal_newlines=True, timeout=60 + len(data) * 20 / args.baud + len(data) / size * args.loss / 25)
+      output = result.stdout.strip().splitlines()
+      status = firmware.wait(10)
+    except subprocess.TimeoutExpired:
+      firmware.kill()
+      output, status = ["Timed out"], 1
+
+    print("%s%s:" % (name[0].upper(), name[1:]))
+    for line in output: print("  " + line)
+    good = os.path.exists(received) and open(received, 'rb').read() == data
+    if not good or status:
+      print("  The file didn't come through intact" if not good else "  The stream didn't return to ASCII mode")
+      failed = True
+
+sys.exit(1 if failed else 0)
@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+"""
+Upload a file to the SD card with the binary file transfer protocol (BINARY_FILE_TRANSFER).
+
+After 'M28 B1' the firmware takes packets of:
+
+  token:0xB5AD sync:uint8 protocol<<4|type:uint8 size:uint16 header_checksum:uint16 data[size] checksum:uint16
+
+and answers each good one with "ok<sync>". With BINARY_STREAM_WINDOW it
+replies "ws<n>" to the WINDOW control packet, and then up to n packets can
+be sent before the oldest is acknowledged. "rs<sync>" asks for one packet
+again. Firmware without the window replies "ws1", or not at all if it's
+older, and the upload falls back to one packet at a time.
+
+The time taken and the rate are printed at the end, so the script also
+serves to compare settings.
+
+Needs pyserial (pip install pyserial).
+
+  binary_upload.py /dev/ttyACM0 part.gcode PART.GCO
+  binary_upload.py /dev/ttyACM0 part.gcode PART.GCO --baud 250000 --window 1
+"""
+
+import argparse
+import struct
+import time
+
+import serial
+
+CONTROL, FILE_TRANSFER = 0, 1
+SYNC, CLOSE, WINDOW = 1, 2, 3
+QUERY, OPEN, FCLOSE, WRITE, ABORT = 0, 1, 2, 3, 4
+
+def fletcher(cs, data):
+  # As BinaryStream::checksum
+  for b in data:
+    lo = ((cs & 0xFF) + b) % 255
+    cs = ((((cs >> 8) + lo) % 255) << 8) | lo
+  return cs
+
+def packet(sync, protocol, ptype, data=b''):
+  head = struct.pack('<BBH', sync, protocol << 4 | ptype, len(data))
+  cs = fletcher(0, head)
+  head += struct.pack('<H', cs)
+  cs = fletcher(fletcher(cs, head[4:]), data)
+  return struct.pack('<H', 0xB5AD) + head + data + struct.pack('<H', cs)
+
+class Stream:
+  def __init__(self, port, timeout):
+    self.port, self.timeout = port, timeout
+    self.sync, self.size = 0, 96
+
+  def readline(self, wait):
+    self.port.timeout = wait
+    return self.port.readline().decode('ascii', 'replace').strip()
+
+  def connect(self):
+    self.port.reset_input_buffer()
+    self.port.write(packet(0, CONTROL, SYNC))
+    deadline = time.monotonic() + self.timeout
+    while time.monotonic() < deadline:
+      line = self.readline(self.timeout)
+      if line.startswith('ss'):
+        sync, size, version = line[2:].split(',')[:3]
+        self.sync, self.size = int(sync), int(size)
+        return version
+    raise SystemExit("No reply to sync")
+
+  def send(self, items, window):
+    # Send (protocol, type, data) items with up to 'window' not yet acknowledged, return the PFT and ws replies
+    base = nxt = 0
+    acked, sent, replies = set(), {}, []
+    def put(i):
+      self.port.write(packet((self.sync + i) & 0xFF, *items[i]))
+      sent[i] = time.monotonic()
+
+    while base < len(items):
+      while nxt < len(items) and nxt - base < window:
+        put(nxt)
+        nxt += 1
+      line = self.readline(self.timeout / 4)
+      if line[:2] in ('ok', 'rs') and line[2:].isdigit():
+        i = base + ((int(line[2:]) - self.sync - base) & 0xFF)
+        if i < nxt and i not in acked:
+          if line.startswith('ok'): acked.add(i)
+          else: put(i)
+      elif line.startswith('fe'):
+        raise SystemExit("Stream error, resync needed")
+      elif line.startswith(('PFT:', 'ws')):
+        replies.append(line)
+      while base in acked:
+        acked.remove(base)
+        base += 1
+      now = time.monotonic()
+      for i in range(base, nxt):
+        if i not in acked and now - sent[i] > self.timeout: put(i)
+    self.sync = (self.sync + len(items)) & 0xFF
+    return replies
+
+  def request(self, protocol, ptype, data=b''):
+    # A control or file command on its own, with its reply
+    replies = self.send([(protocol, ptype, data)], 1)
+    deadline = time.monotonic() + self.timeout
+    while not replies and time.monotonic() < deadline:
+      line = self.readline(self.timeout)
+      if line.startswith(('PFT:', 'ws')): replies.append(line)
+    return replies[0] if replies else ''
+
+parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+parser.add_argument('port', help='Serial port of the printer')
+parser.add_argument('file', help='File to upload')
+parser.add_argument('name', help='8.3 name for the file on the SD card')
+parser.add_argument('--baud', type=int, default=115200, help='Baud rate (default 115200)')
+parser.add_argument('--window', type=int, help='Use at most this many packets in flight')
+parser.add_argument('--timeout', type=float, default=1.0, help='Seconds to wait for a reply (default 1)')
+args = parser.parse_args()
+
+with open(args.file, 'rb') as f:
+  data = f.read()
+
+with serial.Serial(args.port, args.baud, timeout=args.timeout) as port:
+  port.write(b'\nM28 B1\n')
+  time.sleep(0.5)
+  stream = Stream(port, args.timeout)
+  version = stream.connect()
+
+  window = 1
+  if version >= '0.2':
+    reply = stream.request(CONTROL, WINDOW)
+    if reply.startswith('ws'): window = int(reply[2:])
+  if args.window: window = max(1, min(window, args.window))
+  print("Protocol %s, %d byte packets, window %d" % (version, stream.size, window))
+
+  if stream.request(FILE_TRANSFER, OPEN, b'\0\0' + args.name.encode() + b'\0') != 'PFT:success':
+    raise SystemExit("Can't open %s" % args.name)
+
+  start = time.monotonic()
+  chunks = [(FILE_TRANSFER, WRITE, data[i:i + stream.size]) for i in range(0, len(data), stream.size)]
+  errors = [r for r in stream.send(chunks, window) if r != 'PFT:success']
+  reply = stream.request(FILE_TRANSFER, FCLOSE)
+  secs = time.monotonic() - start
+  stream.send([(CONTROL, CLOSE, b'')], 1)
+
+  if errors or reply != 'PFT:success':
+    raise SystemExit("Upload failed: %s" % ', '.join(errors + [reply]))
+  print("%d bytes in %.1fs, %.1f KB/s" % (len(data), secs, len(data) / 1024 / max(secs, 0.001)))
@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+"""
+Read the boot stage timings of a printer built with BOOT_STAGE_TIMING (M990)
+and total them, to compare builds and settings on the real board.
+
+Stages run from idle() after setup() (LVGL_DEFERRED_INIT) are listed apart,
+since the printer already answers while they run. With --budget the exit
+status is 1 when setup() took longer than that, so the script can gate a
+bench test.
+
+With --boot it waits for the board to restart and report "start" first, for
+boards whose serial port survives a reset (most STM32 boards): press reset or
+power on once the script is waiting.
+
+Needs pyserial (pip install pyserial).
+
+  boot_stages.py /dev/ttyUSB0
+  boot_stages.py /dev/ttyUSB0 --boot --budget 1500
+"""
+
+import argparse
+import re
+import sys
+import time
+
+import serial
+
+parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+parser.add_argument('port', help='Serial port of the printer')
+parser.add_argument('--baud', type=int, default=115200, help='Baud rate (default 115200)')
+parser.add_argument('--boot', action='store_true', help='Wait for the board to boot before asking')
+parser.add_argument('--settle', type=float, default=5, help='Seconds to wait after booting for the deferred stages (default 5)')
+parser.add_argument('--budget', type=int, help='Fail if setup() took more than this many ms')
+parser.add_argument('--timeout', type=float, default=60, help='Seconds to wait for the board (default 60)')
+args = parser.parse_args()
+
+STAGE = re.compile(r'^\s+(.+?) (\d+)( \(deferred\))?$')
+
+with serial.Serial(args.port, args.baud, timeout=1) as port:
+  deadline = time.monotonic() + args.timeout + (args.settle if args.boot else 0)
+
+  def readline():
+    if time.monotonic() > deadline: sys.exit("No reply from the printer")
+    return port.readline().decode('ascii', 'replace').rstrip()
+
+  if args.boot:
+    print("Waiting for the printer to boot...")
+    while readline() != 'start': pass
+    # Let setup() finish, then give the deferred stages time to run
+    while readline(): pass
+    time.sleep(args.settle)
+
+  port.reset_input_buffer()
+  port.write(b'M990\n')
+  stages = []
+  while True:
+    line = readline()
+    if line.startswith('ok'): break
+    m = STAGE.match(line)
+    if m: stages.append((m.group(1), int(m.group(2)), bool(m.group(3))))
+
+if not stages: sys.exit("No stages reported. Is BOOT_STAGE_TIMING enabled?")
+
+width = max(len(s[0]) for s in stages)
+for deferred in (False, True):
+  part = [s for s in stages if s[2] == deferred]
+  if not part: continue
+  print("After setup(), from idle():" if deferred else "In setup():")
+  for name, ms, _ in part: print("  %-*s %6d ms" % (width, name, ms))
+  print("  %-*s %6d ms" % (width, 'Total', sum(s[1] for s in part)))
+
+setup_ms = sum(s[1] for s in stages if not s[2])
+if args.budget is not None and setup_ms > args.budget:
+  sys.exit("setup() took %d ms, over the budget of %d ms" % (setup_ms, args.budget))
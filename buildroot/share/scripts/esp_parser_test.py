@@ -0,0 +1,172 @@
+#!/usr/bin/env python3
+"""
+Feed an MKS WiFi upload through esp_data_parser() on the host.
+
+esp_data_parser() and its helpers are taken from wifi_module.cpp as they are.
+The frame handlers are replaced by ones that check what arrives. A stream of
+ESP frames is built as the module sends it: a file name frame, then numbered
+file fragments with a G-code frame now and then, the last fragment flagged.
+The stream is handed over in random pieces, as wifi_rcv_handle() takes
+whatever the DMA ring holds, and every frame must come out whole and in order.
+
+The parsing rate is printed next to the upload line rate (WIFI_UPLOAD_BAUDRATE,
+10 bits per byte), as a host figure to compare against, not a printer one.
+
+Builds with $CXX, or c++.
+
+  esp_parser_test.py
+  esp_parser_test.py --size 8 --seed 5
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+MKS_UI = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', '..',
+                      'Marlin', 'src', 'lcd', 'extui', 'lib', 'mks_ui')
+
+HARNESS = r'''
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#define UART_RX_BUFFER_SIZE %(rx_buffer)s
+#define WIFI_UPLOAD_BAUDRATE %(baudrate)s
+#define ZERO(a) memset(a, 0, sizeof(a))
+#define FRAG_MASK ~(1 << 31)
+
+%(protocol)s
+
+// Checking handlers in place of the real ones
+static std::vector<uint8_t> file_data;
+static uint32_t next_fragment, gcode_frames, errors;
+static bool got_name, got_last;
+
+static void fail(const char *what) { if (!errors++) printf("%%s\n", what); }
+
+static void file_first_msg_handle(uint8_t *msg, uint16_t msgLen) {
+  if (msgLen < 2 || memcmp(msg + msgLen - 4, ".gco", 4)) fail("Bad file name frame");
+  got_name = true;
+}
+
+static void file_fragment_msg_handle(uint8_t *msg, uint16_t msgLen) {
+  uint32_t frag;
+  memcpy(&frag, msg, sizeof(frag));
+  if ((frag & FRAG_MASK) != next_fragment) { fail("Fragment out of order"); return; }
+  next_fragment++;
+  file_data.insert(file_data.end(), msg + 4, msg + msgLen);
+  if (frag & ~FRAG_MASK) got_last = true;
+}
+
+static void gcode_msg_handle(uint8_t *msg, uint16_t msgLen) {
+  if (msgLen != 4 || memcmp(msg, "M27\n", 4)) fail("Bad G-code frame");
+  gcode_frames++;
+}
+
+static void net_msg_handle(uint8_t *, uint16_t) { fail("Unexpected net frame"); }
+static void wifi_list_msg_handle(uint8_t *, uint16_t) { fail("Unexpected WiFi list frame"); }
+
+%(functions)s
+
+static void frame(std::vector<uint8_t> &out, const uint8_t type, const uint8_t *data, const uint16_t len) {
+  out.push_back(ESP_PROTOC_HEAD);
+  out.push_back(type);
+  out.push_back(len & 0xFF);
+  out.push_back(len >> 8);
+  out.insert(out.end(), data, data + len);
+  out.push_back(ESP_PROTOC_TAIL);
+}
+
+int main(int argc, char **argv) {
+  const uint32_t size = atoi(argv[1]) * 1024UL * 1024UL;
+  srand(atoi(argv[2]));
+
+  // The file holds every byte value, the head and tail marks included
+  std::vector<uint8_t> file(size), stream;
+  for (auto &b : file) b = rand();
+
+  const char name[] = "\x01\x0a" "upload.gco";
+  frame(stream, ESP_TYPE_FILE_FIRST, (const uint8_t*)name, sizeof(name) - 1);
+  uint8_t data[UART_RX_BUFFER_SIZE];
+  uint32_t frags = 0, gcodes = 0;
+  for (uint32_t pos = 0; pos < size; frags++) {
+    // The module sends up to a whole receive buffer per frame
+    const uint16_t chunk = 1 + rand() %% (sizeof(data) - 9);
+    const uint32_t n = pos + chunk > size ? size - pos : chunk;
+    uint32_t frag = frags | (pos + n == size ? ~FRAG_MASK : 0);
+    memcpy(data, &frag, 4);
+    memcpy(data + 4, &file[pos], n);
+    frame(stream, ESP_TYPE_FILE_FRAGMENT, data, n + 4);
+    pos += n;
+    if (!(rand() %% 64)) { frame(stream, ESP_TYPE_GCODE, (const uint8_t*)"M27\n", 4); gcodes++; }
+  }
+
+  // Pieces of any size up to a frame, as the ring is drained
+  std::vector<uint32_t> cuts;
+  for (uint32_t pos = 0; pos < stream.size();) {
+    const uint32_t n = 1 + rand() %% UART_RX_BUFFER_SIZE;
+    cuts.push_back(pos + n < stream.size() ? n : stream.size() - pos);
+    pos += cuts.back();
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  uint32_t pos = 0;
+  for (const uint32_t n : cuts) { esp_data_parser((char*)&stream[pos], n); pos += n; }
+  const double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  if (!got_name) fail("No file name frame");
+  if (next_fragment != frags || !got_last) fail("Fragments missing");
+  if (gcode_frames != gcodes) fail("G-code frames missing");
+  if (file_data != file) fail("File data differs");
+  if (errors) return 1;
+
+  printf("%%u fragments and %%u G-code frames in %%u pieces came through intact\n", frags, gcodes, (unsigned)cuts.size());
+  printf("Parsed %%.1f MB/s on this host, the upload line carries %%.2f MB/s\n",
+    stream.size() / secs / 1e6, WIFI_UPLOAD_BAUDRATE / 10.0 / 1e6);
+  return 0;
+}
+'''
+
+def function(source, name):
+  # A top-level function, from its signature to the closing brace in column 0
+  m = re.search(r'^[\w ]+\b%s\(.*?^}\n' % name, source, re.M | re.S)
+  if not m: sys.exit("%s() not found in wifi_module.cpp" % name)
+  return m.group(0)
+
+def define(source, name):
+  m = re.search(r'^#define\s+%s\s+(\S+)' % name, source, re.M)
+  if not m: sys.exit("%s not found" % name)
+  return m.group(1)
+
+parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+parser.add_argument('--size', type=int, default=4, help='MB of file data to upload (default 4)')
+parser.add_argument('--seed', type=int, default=1, help='Random seed (default 1)')
+args = parser.parse_args()
+
+def read(name):
+  with open(os.path.join(MKS_UI, name)) as f: return f.read()
+
+module, header, serial = read('wifi_module.cpp'), read('wifi_module.h'), read('wifiSerial.h')
+
+# The frame marks, types, parse buffer and frame struct
+m = re.search(r'^#define ESP_PROTOC_HEAD.*?^} ESP_PROTOC_FRAME;\n', module, re.M | re.S)
+if not m: sys.exit("The ESP protocol definitions weren't found in wifi_module.cpp")
+
+code = HARNESS % {
+  'rx_buffer': define(header, 'UART_RX_BUFFER_SIZE'),
+  'baudrate': define(serial, 'WIFI_UPLOAD_BAUDRATE'),
+  'protocol': m.group(0),
+  'functions': '\n'.join(function(module, f) for f in ('cut_msg_head', 'charAtArray', 'esp_data_parser')),
+}
+
+with tempfile.TemporaryDirectory() as tmp:
+  cpp, exe = os.path.join(tmp, 'esp_parser_test.cpp'), os.path.join(tmp, 'esp_parser_test')
+  with open(cpp, 'w') as f: f.write(code)
+  subprocess.check_call([os.environ.get('CXX', 'c++'), '-O2', '-std=gnu++11', '-o', exe, cpp])
+  sys.exit(subprocess.call([exe, str(args.size), str(args.seed)]))
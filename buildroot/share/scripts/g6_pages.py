@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+"""
+Turn the G0/G1 moves of a G-code file into direct stepping pages that the
+firmware (DIRECT_STEPPING_SD) plays from the SD card with 'G6 !file'.
+
+Each move speeds up and slows down with the given acceleration. Moves don't
+blend into each other, so the script is a reference for the page file rather
+than a planner. The file is:
+
+  header  "G6PG" format:uint8 0:uint8 page_size:uint16
+  pages   { step_rate:uint32 steps:uint16 dirs:uint8 0:uint8 page[page_size] }...
+
+step_rate, steps and dirs are the R, S and X Y Z E values of G6. The format
+is the STEPPER_PAGE_FORMAT the firmware is built with:
+
+  4x4D_128  128 segments of 7 steps, 4-bit -7..7 per axis (format 1)
+  4x2_256   256 segments of 3 steps, 2-bit 0..3 per axis (format 4, default)
+  4x1_512   512 single steps, 1 bit per axis (format 5)
+
+The print must start where the G-code does, so home and move there first,
+then 'G92' to the starting position, or start the G-code from the origin.
+
+  g6_pages.py part.gcode PART.G6 --steps 80,80,400,93
+  g6_pages.py part.gcode PART.G6 --steps 80,80,400,93 --rate 60000 --accel 3000
+"""
+
+import argparse
+import math
+import re
+import struct
+
+FORMATS = {  # id, segments, steps per segment, bits, directional
+  '4x4D_128': (1, 128, 7, 4, True),
+  '4x2_256':  (4, 256, 3, 2, False),
+  '4x1_512':  (5, 512, 1, 1, False),
+}
+AXES = 'XYZE'
+
+parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+parser.add_argument('gcode', help='G-code file with the moves')
+parser.add_argument('out', help='Page file to write')
+parser.add_argument('--steps', required=True, help='Steps per mm for X,Y,Z,E')
+parser.add_argument('--format', choices=FORMATS, default='4x2_256', help='STEPPER_PAGE_FORMAT (default 4x2_256)')
+parser.add_argument('--rate', type=int, default=40000, help='Steps per second, as G6 R (default 40000)')
+parser.add_argument('--accel', type=float, default=2000, help='Acceleration in mm/s^2 (default 2000)')
+args = parser.parse_args()
+
+fmt_id, segments, seg_steps, bits, directional = FORMATS[args.format]
+page_size = 4 * bits * segments // 8
+limit = seg_steps if not directional else 7
+steps_mm = [float(s) for s in args.steps.split(',')]
+seg_time = seg_steps / args.rate
+
+class Pages:
+  def __init__(self):
+    self.data = bytearray(b'G6PG' + struct.pack('<BBH', fmt_id, 0, page_size))
+    self.segs, self.dirs, self.count, self.clipped, self.total = [], None, 0, 0, 0
+
+  def flush(self):
+    if not self.segs: return
+    page = bytearray(page_size)
+    for i, d in enumerate(self.segs):
+      if args.format == '4x4D_128':
+        page[i * 2] = (d[0] + 7) << 4 | (d[1] + 7)
+        page[i * 2 + 1] = (d[2] + 7) << 4 | (d[3] + 7)
+      elif args.format == '4x2_256':
+        page[i] = abs(d[0]) << 6 | abs(d[1]) << 4 | abs(d[2]) << 2 | abs(d[3])
+      else:
+        nib = sum(1 << (3 - a) for a in range(4) if d[a])
+        page[i >> 1] |= nib << 4 if i & 1 else nib
+    steps = 0 if len(self.segs) == segments else len(self.segs) * seg_steps
+    dirs = sum(1 << a for a in range(4) if (self.dirs or [0] * 4)[a] >= 0)
+    self.data += struct.pack('<IHBB', args.rate, steps, dirs, 0) + page
+    self.segs, self.dirs = [], None
+    self.count += 1
+
+  def add(self, d):
+    if any(abs(v) > limit for v in d):
+      self.clipped += 1
+      d = [max(-limit, min(limit, v)) for v in d]
+    if not directional:
+      # A page has one direction per axis, start a new one when it changes
+      if self.dirs is None: self.dirs = [0] * 4
+      if any(v and self.dirs[a] and (v > 0) != (self.dirs[a] > 0) for a, v in enumerate(d)): self.flush(); self.dirs = [0] * 4
+      for a, v in enumerate(d):
+        if v: self.dirs[a] = v
+    self.segs.append(d)
+    self.total += 1
+    if len(self.segs) == segments: self.flush()
+    return d
+
+pages = Pages()
+pos = [0.0] * 4      # mm
+done = [0] * 4       # steps sent
+feed = 1500.0        # mm/min
+absolute, e_absolute = True, True
+
+def move(target, feedrate):
+  delta = [t - p for t, p in zip(target, pos)]
+  dist = math.sqrt(sum(d * d for d in delta[:3])) or abs(delta[3])
+  if dist == 0: return
+  v = feedrate / 60
+  # Trapezoid, or a triangle if it never reaches the speed
+  t_acc = v / args.accel
+  d_acc = 0.5 * args.accel * t_acc ** 2
+  if 2 * d_acc > dist:
+    t_acc = math.sqrt(dist / args.accel)
+    d_acc, v = dist / 2, args.accel * t_acc
+  t_cruise = (dist - 2 * d_acc) / v
+  total = 2 * t_acc + t_cruise
+
+  def along(t):
+    if t < t_acc: return 0.5 * args.accel * t * t
+    if t < t_acc + t_cruise: return d_acc + v * (t - t_acc)
+    t = min(total, t) - t_acc - t_cruise
+    return d_acc + v * t_cruise + v * t - 0.5 * args.accel * t * t
+
+  start = pos[:]
+  for k in range(1, math.ceil(total / seg_time) + 1):
+    f = along(k * seg_time) / dist
+    want = [round((start[a] + delta[a] * f) * steps_mm[a]) for a in range(4)]
+    d = pages.add([w - s for w, s in zip(want, done)])
+    done[:] = [s + x for s, x in zip(done, d)]
+  pos[:] = target
+
+with open(args.gcode) as f:
+  for line in f:
+    line = line.split(';')[0].strip().upper()
+    if not line: continue
+    words = dict((m[0], float(m[1:])) for m in re.findall(r'[A-Z][-+]?[0-9.]+', line))
+    cmd = line.split()[0]
+    if cmd in ('G0', 'G1', 'G00', 'G01'):
+      if 'F' in words: feed = words['F']
+      target = pos[:]
+      for a, ax in enumerate(AXES):
+        if ax in words:
+          target[a] = words[ax] if (e_absolute if ax == 'E' else absolute) else pos[a] + words[ax]
+      move(target, feed)
+    elif cmd == 'G90': absolute = e_absolute = True
+    elif cmd == 'G91': absolute = e_absolute = False
+    elif cmd == 'M82': e_absolute = True
+    elif cmd == 'M83': e_absolute = False
+    elif cmd == 'G92':
+      for a, ax in enumerate(AXES):
+        if ax in words:
+          pos[a] = words[ax]
+          done[a] = round(pos[a] * steps_mm[a])
+
+pages.flush()
+with open(args.out, 'wb') as f:
+  f.write(pages.data)
+
+print("%d pages, %d bytes, %.1fs of motion" % (pages.count, len(pages.data), pages.total * seg_time))
+if pages.clipped:
+  print("%d segments were over %d steps, lower the feedrate or raise --rate" % (pages.clipped, limit))
@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+"""
+Check hex_decode() of the MKS UI against the ascii2dec_test() decoding it
+replaced, and time both.
+
+The two functions are taken from draw_print_file.cpp as they are, built for
+the host with the C++ compiler ($CXX, or c++) and run on random thumbnail rows:
+upper and lower case digits, odd lengths and unaligned sources. The timing is
+in pixels (two bytes) per millisecond on the host, so it only compares the two,
+it says nothing about the speed on the printer.
+
+  hex_decode_test.py
+  hex_decode_test.py --rounds 20000
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+SOURCE = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', '..',
+                      'Marlin', 'src', 'lcd', 'extui', 'lib', 'mks_ui', 'draw_print_file.cpp')
+
+HARNESS = r'''
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+%(functions)s
+
+// The per-character loop that hex_decode() replaced
+static void old_decode(uint8_t *dst, char *src, const uint16_t bytes) {
+  for (uint16_t i = 0; i < bytes; i++)
+    dst[i] = ascii2dec_test(&src[i * 2]) << 4 | ascii2dec_test(&src[i * 2 + 1]);
+}
+
+template<typename F> static double pixels_per_ms(F decode, char *src, uint8_t *dst, const int rounds) {
+  const auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < rounds; r++)
+    for (int row = 0; row < 200; row++) decode(dst + (row & 1) * 400, src + row * 800, 400);
+  const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+  return 200.0 * 200.0 * rounds / (ms > 0 ? ms : 1e-6);
+}
+
+int main(int argc, char **argv) {
+  const int rounds = argc > 1 ? atoi(argv[1]) : 1000;
+  const char digits[] = "0123456789abcdef0123456789ABCDEF";
+  static char text[200 * 800 + 8];
+  static uint8_t want[800], got[800];
+
+  srand(1);
+  for (int t = 0; t < 100000; t++) {
+    const uint16_t bytes = 1 + rand() %% 400, skew = rand() %% 4;
+    char * const src = text + skew;
+    for (uint16_t i = 0; i < bytes * 2; i++) src[i] = digits[rand() %% 32];
+    old_decode(want, src, bytes);
+    hex_decode(got, src, bytes);
+    if (memcmp(want, got, bytes)) {
+      printf("Mismatch for %%u bytes at offset %%u: %%.*s\n", bytes, skew, bytes * 2, src);
+      return 1;
+    }
+  }
+  puts("hex_decode matches ascii2dec_test on 100000 random rows");
+
+  for (size_t i = 0; i < sizeof(text) - 8; i++) text[i] = digits[rand() %% 32];
+  const double was = pixels_per_ms(old_decode, text, got, rounds),
+               now = pixels_per_ms(hex_decode, text, got, rounds);
+  printf("ascii2dec_test %%.0f pixels/ms, hex_decode %%.0f pixels/ms (x%%.1f) on this host\n", was, now, now / was);
+  return 0;
+}
+'''
+
+def function(source, name):
+  # The definition of a top-level function, from its signature to the closing brace in column 0
+  m = re.search(r'^[\w ]+\b%s\(.*?^}\n' % name, source, re.M | re.S)
+  if not m: sys.exit("%s() not found in %s" % (name, SOURCE))
+  return m.group(0)
+
+parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+parser.add_argument('--rounds', type=int, default=1000, help='200x200 thumbnails to decode for the timing (default 1000)')
+args = parser.parse_args()
+
+with open(SOURCE) as f:
+  source = f.read()
+
+with tempfile.TemporaryDirectory() as tmp:
+  cpp, exe = os.path.join(tmp, 'hex_decode_test.cpp'), os.path.join(tmp, 'hex_decode_test')
+  with open(cpp, 'w') as f:
+    f.write(HARNESS % { 'functions': function(source, 'ascii2dec_test') + '\n' + function(source, 'hex_decode') })
+  subprocess.check_call([os.environ.get('CXX', 'c++'), '-O2', '-o', exe, cpp])
+  sys.exit(subprocess.call([exe, str(args.rounds)]))
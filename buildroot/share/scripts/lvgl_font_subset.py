@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+"""
+Pack only the glyphs the LVGL UI can show into a compact FontUNIGBK.bin.
+
+The full MKS LVGL UI font has a table entry for every code point from the
+header's min to max, most of them empty. The packed font instead lists
+the glyphs it has, sorted by code point, and the firmware finds them by
+binary search. It is marked by 'P' in the header's format byte:
+
+  header   min, max (uint16), bpp, 'P', count (uint16)
+  entries  count x (code point uint16, position uint32)
+  glyphs   advance, width, bitmap; as in the full font
+
+Characters come from the tft_Language_*.h string tables, printable ASCII
+(file names, numbers) and any extra text given with --text. Glyphs that
+are left out simply aren't drawn, so add the names of your G-code files
+with --text if they use other characters. Copy the result over the
+FontUNIGBK.bin in the assets folder of the SD card.
+
+  lvgl_font_subset.py assets/FontUNIGBK.bin FontUNIGBK.bin
+  lvgl_font_subset.py assets/FontUNIGBK.bin FontUNIGBK.bin --text "°±"
+"""
+
+import argparse
+import glob
+import os
+import re
+import struct
+
+HEADER = struct.Struct('<HHBcH')    # min, max, bpp, format, count
+POS = struct.Struct('<I')
+ENTRY = struct.Struct('<HI')        # code point, position
+
+here = os.path.dirname(os.path.abspath(__file__))
+default_lang = os.path.join(here, '..', '..', '..', 'Marlin', 'src', 'lcd', 'extui', 'lib', 'mks_ui')
+
+parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+parser.add_argument('font', help='Full FontUNIGBK.bin')
+parser.add_argument('out', help='Packed font to write')
+parser.add_argument('--lang-dir', default=default_lang, help='Folder with the tft_Language_*.h files')
+parser.add_argument('--text', action='append', default=[], help='Extra characters to keep')
+args = parser.parse_args()
+
+# Every character in a string literal of the language tables
+chars = set(chr(c) for c in range(0x20, 0x7F))
+for fn in glob.glob(os.path.join(args.lang_dir, 'tft_Language_*.h')):
+  with open(fn, encoding='utf-8') as f:
+    for lit in re.findall(r'"((?:[^"\\]|\\.)*)"', f.read()):
+      chars.update(lit)
+for t in args.text:
+  chars.update(t)
+
+with open(args.font, 'rb') as f:
+  font = f.read()
+
+fmin, fmax, bpp, fmt, _ = HEADER.unpack_from(font, 0)
+if fmt == b'P':
+  raise SystemExit("%s is already packed" % args.font)
+table = [POS.unpack_from(font, HEADER.size + i * POS.size)[0] for i in range(fmax - fmin + 1)]
+
+# A glyph runs up to the next one in the file
+ends = sorted(set(p for p in table if p) | {len(font)})
+def glyph(pos):
+  return font[pos:ends[ends.index(pos) + 1]]
+
+keep = sorted(ord(c) for c in chars if fmin <= ord(c) <= fmax and table[ord(c) - fmin])
+missing = sorted(c for c in chars if not (fmin <= ord(c) <= fmax and table[ord(c) - fmin]))
+
+out = bytearray(HEADER.pack(keep[0], keep[-1], bpp, b'P', len(keep)))
+out += bytes(ENTRY.size * len(keep))
+for i, c in enumerate(keep):
+  ENTRY.pack_into(out, HEADER.size + i * ENTRY.size, c, len(out))
+  out += glyph(table[c - fmin])
+
+with open(args.out, 'wb') as f:
+  f.write(out)
+
+print("%d glyphs, %d -> %d bytes" % (len(keep), len(font), len(out)))
+if missing:
+  print("Not in the font: " + ''.join(c for c in missing if c.isprintable()))
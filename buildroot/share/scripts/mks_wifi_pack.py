@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+"""
+Pack a G-code file for a faster upload through the MKS WiFi module.
+
+The firmware (MKS_WIFI_COMPRESSED_UPLOAD) unpacks it as it writes it to the
+SD card, so the file is stored as plain G-code under the name it's uploaded
+with. The data is a heatshrink stream with the -w 8 -l 4 settings of
+heatshrink_config.h, cut into blocks that each carry a CRC16:
+
+  "HSGC" { size:uint16 crc:uint16 data[size] }... { 0:uint16 0:uint16 } length:uint32
+
+Needs the heatshrink2 Python module (pip install heatshrink2) or the
+heatshrink tool on the PATH.
+
+  mks_wifi_pack.py part.gcode part.gco
+"""
+
+import argparse
+import os
+import struct
+import subprocess
+import tempfile
+
+TAG = b'HSGC'
+BLOCK = 1024
+
+def crc16(data):
+  # CRC-16/XMODEM, as in libs/crc16.cpp
+  crc = 0
+  for b in data:
+    crc ^= b << 8
+    for _ in range(8):
+      crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+    crc &= 0xFFFF
+  return crc
+
+def heatshrink(data):
+  try:
+    import heatshrink2
+    return heatshrink2.compress(data, window_sz2=8, lookahead_sz2=4)
+  except ImportError:
+    pass
+  with tempfile.TemporaryDirectory() as tmp:
+    src, dst = os.path.join(tmp, 'in'), os.path.join(tmp, 'out')
+    with open(src, 'wb') as f:
+      f.write(data)
+    subprocess.run(['heatshrink', '-e', '-w', '8', '-l', '4', src, dst], check=True)
+    with open(dst, 'rb') as f:
+      return f.read()
+
+parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+parser.add_argument('gcode', help='G-code file to pack')
+parser.add_argument('out', help='Packed file to upload')
+args = parser.parse_args()
+
+with open(args.gcode, 'rb') as f:
+  gcode = f.read()
+
+packed = heatshrink(gcode)
+out = bytearray(TAG)
+for i in range(0, len(packed), BLOCK):
+  block = packed[i:i + BLOCK]
+  out += struct.pack('<HH', len(block), crc16(block)) + block
+out += struct.pack('<HHI', 0, 0, len(gcode))
+
+with open(args.out, 'wb') as f:
+  f.write(out)
+
+print("%d -> %d bytes (%.1fx)" % (len(gcode), len(out), len(gcode) / max(len(out), 1)))